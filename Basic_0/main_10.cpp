@@ -1,5 +1,6 @@
 #include "raylib.h"
 #include <math.h> // For fminf and fmaxf
+#include "face/arc_lod.h"
 
 void MyDrawSlopedRoundedRectangle(Rectangle rec, float radiusBottom, float radiusTop, float slopeFactor, int segments, Color color)
 {
@@ -77,13 +78,13 @@ void MyDrawSlopedRoundedRectangle(Rectangle rec, float radiusBottom, float radiu
     // These must be drawn last to cover any minor seams or misalignments.
     
     // TL (180-270) - radiusTop
-    DrawCircleSector(centers[0], radiusTop, 180.0f, 270.0f, segments, color);
+    DrawCircleSector(centers[0], radiusTop, 180.0f, 270.0f, ArcSegmentsOrAuto(segments, radiusTop), color);
     // TR (270-360) - radiusTop
-    DrawCircleSector(centers[1], radiusTop, 270.0f, 360.0f, segments, color);
+    DrawCircleSector(centers[1], radiusTop, 270.0f, 360.0f, ArcSegmentsOrAuto(segments, radiusTop), color);
     // BR (0-90) - radiusBottom
-    DrawCircleSector(centers[2], radiusBottom, 0.0f, 90.0f, segments, color);
+    DrawCircleSector(centers[2], radiusBottom, 0.0f, 90.0f, ArcSegmentsOrAuto(segments, radiusBottom), color);
     // BL (90-180) - radiusBottom
-    DrawCircleSector(centers[3], radiusBottom, 90.0f, 180.0f, segments, color);
+    DrawCircleSector(centers[3], radiusBottom, 90.0f, 180.0f, ArcSegmentsOrAuto(segments, radiusBottom), color);
 }
 
 int main()
@@ -102,7 +103,7 @@ int main()
     float radiusBottom = 40.0f; // Example bottom radius
     float radiusTop = 30.0f;    // Example top radius
     float slopeFactor = 0.2f;   // Example slope factor (positive makes top-right shift left)
-    int segments = 16;          // Arc segments
+    int segments = 0;           // Arc segments (0 = auto from radius)
 
     while (!WindowShouldClose())
     {
@@ -124,7 +125,7 @@ int main()
         if (IsKeyDown(KEY_T)) slopeFactor -= 0.005f;
         if (IsKeyDown(KEY_Y)) slopeFactor += 0.005f;
 
-        if (IsKeyDown(KEY_F)) segments = fmaxf(3, segments - 1);
+        if (IsKeyDown(KEY_F)) segments = fmaxf(0, segments - 1);
         if (IsKeyDown(KEY_G)) segments = fminf(360, segments + 1);
 
 
@@ -147,7 +148,7 @@ int main()
         DrawText(TextFormat("Radius Bottom: %.1f (Q/W)", radiusBottom), 10, 10, 20, BLACK);
         DrawText(TextFormat("Radius Top: %.1f (E/R)", radiusTop), 10, 40, 20, BLACK);
         DrawText(TextFormat("Slope Factor: %.2f (T/Y)", slopeFactor), 10, 70, 20, BLACK);
-        DrawText(TextFormat("Segments: %d (F/G)", segments), 10, 100, 20, BLACK);
+        DrawText((segments > 0) ? TextFormat("Segments: %d (F/G)", segments) : "Segments: auto (F/G)", 10, 100, 20, BLACK);
 
 
         EndDrawing();
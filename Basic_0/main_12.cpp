@@ -1,5 +1,6 @@
 #include "raylib.h"
 #include <math.h>
+#include "face/arc_lod.h"
 
 // --- Function Prototypes ---
 void MyDrawSlopedRoundedRectangle(Rectangle rec, float radiusBottom, float radiusTop, float slopeFactor, int segments, Color color);
@@ -20,7 +21,7 @@ int main()
     float radiusBottom = 40.0f;
     float radiusTop = 30.0f;
     float slopeFactor = 0.2f;
-    int segments = 16;
+    int segments = 0; // 0 = auto from radius
 
     while (!WindowShouldClose())
     {
@@ -33,7 +34,7 @@ int main()
         if (IsKeyDown(KEY_T)) slopeFactor -= 0.005f;
         if (IsKeyDown(KEY_Y)) slopeFactor += 0.005f;
 
-        if (IsKeyDown(KEY_F)) segments = fmaxf(3, segments - 1);
+        if (IsKeyDown(KEY_F)) segments = fmaxf(0, segments - 1);
         if (IsKeyDown(KEY_G)) segments = fminf(360, segments + 1);
 
         BeginDrawing();
@@ -66,7 +67,7 @@ int main()
         DrawText(TextFormat("Radius Bottom: %.1f (Q/W)", radiusBottom), 10, 10, 20, BLACK);
         DrawText(TextFormat("Radius Top: %.1f (E/R)", radiusTop), 10, 40, 20, BLACK);
         DrawText(TextFormat("Slope Factor: %.2f (T/Y)", slopeFactor), 10, 70, 20, BLACK);
-        DrawText(TextFormat("Segments: %d (F/G)", segments), 10, 100, 20, BLACK);
+        DrawText((segments > 0) ? TextFormat("Segments: %d (F/G)", segments) : "Segments: auto (F/G)", 10, 100, 20, BLACK);
 
         EndDrawing();
     }
@@ -164,11 +165,11 @@ void MyDrawSlopedRoundedRectangleWires(Rectangle rec, float radiusBottom, float
     // 4. Draw the 4 corner arcs (Quarter Circles)
     
     // TL (180-270)
-    DrawCircleSectorLines(centers[0], radiusTop, 180.0f, 270.0f, segments, color);
+    DrawCircleSectorLines(centers[0], radiusTop, 180.0f, 270.0f, ArcSegmentsOrAuto(segments, radiusTop), color);
     // TR (270-360)
-    DrawCircleSectorLines(centers[1], radiusTop, 270.0f, 360.0f, segments, color);
+    DrawCircleSectorLines(centers[1], radiusTop, 270.0f, 360.0f, ArcSegmentsOrAuto(segments, radiusTop), color);
     // BR (0-90)
-    DrawCircleSectorLines(centers[2], radiusBottom, 0.0f, 90.0f, segments, color);
+    DrawCircleSectorLines(centers[2], radiusBottom, 0.0f, 90.0f, ArcSegmentsOrAuto(segments, radiusBottom), color);
     // BL (90-180)
-    DrawCircleSectorLines(centers[3], radiusBottom, 90.0f, 180.0f, segments, color);
+    DrawCircleSectorLines(centers[3], radiusBottom, 90.0f, 180.0f, ArcSegmentsOrAuto(segments, radiusBottom), color);
 }
\ No newline at end of file
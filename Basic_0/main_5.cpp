@@ -3,6 +3,10 @@
 #include "raygui.h"
 #include "raymath.h" // For Vector2 operations like Vector2Add, Vector2Subtract
 #include <algorithm> // For std::min/max if needed, or std::clamp in C++17
+#include "face/arc_lod.h"
+#include "face/arc_tables.h"
+#include "face/eye_store.h"
+#include <string.h>
 
 // --- Shape Configuration ---
 // Combines your original eye config with the new color controls
@@ -41,16 +45,8 @@ static const ShapeConfig Preset_NeutralShape = {
 class ShapeDrawer {
 public:
     // Pure function to draw the custom shape
-    // Takes center coordinates and configuration, draws directly to raylib's drawing buffer
-    static void Draw(int centerX, int centerY, const ShapeConfig &cfg) {
-        // Convert float color components to raylib Color struct
-        Color shapeColor = {
-            (unsigned char)cfg.R,
-            (unsigned char)cfg.G,
-            (unsigned char)cfg.B,
-            (unsigned char)cfg.A
-        };
-
+    // Takes center coordinates, geometry and the already packed colour, draws directly to raylib's drawing buffer
+    static void Draw(int centerX, int centerY, const EyeConfig &cfg, Color shapeColor) {
         // --- Calculate Core Points and Adjustments ---
         float halfWidth = cfg.Width / 2.0f;
         float halfHeight = cfg.Height / 2.0f;
@@ -134,18 +130,13 @@ public:
         // Points for the main polygon outline for filling (conceptual, adjusted for slopes and radii)
         Vector2 polygonPoints[8];
         int numPoints = 0;
+        const Vector2 *arcDirs = QuarterArcDirections(9); // 9 segments = 10 degree steps
 
         // Top-left arc (start from left, go up-right)
         if (actualRadiusTop > 0) {
-            float startAngle = 180.0f; // From left
-            float endAngle = 270.0f;   // To top
-            // Iterate to get points for the arc, and add them to polygonPoints
-            for (float angle = startAngle; angle <= endAngle; angle += 10.0f) { // 10 degree steps
-                if (numPoints < 8) {
-                    polygonPoints[numPoints].x = TL_arc_center.x + actualRadiusTop * cosf(DEG2RAD * angle);
-                    polygonPoints[numPoints].y = TL_arc_center.y + actualRadiusTop * sinf(DEG2RAD * angle);
-                    numPoints++;
-                }
+            // 180 to 270 degrees in 10 degree steps, read from the baked quarter-circle table
+            for (int i = 0; i <= 9 && numPoints < 8; i++) {
+                polygonPoints[numPoints++] = ArcTablePoint(arcDirs, i, 2, TL_arc_center, actualRadiusTop);
             }
         } else {
             if (numPoints < 8) { polygonPoints[numPoints++] = {currentCenterX - halfWidth, currentCenterY - halfHeight - topSlopeOffset / 2.0f}; }
@@ -153,14 +144,9 @@ public:
 
         // Top-right arc
         if (actualRadiusTop > 0) {
-            float startAngle = 270.0f; // From top
-            float endAngle = 360.0f;   // To right
-            for (float angle = startAngle; angle <= endAngle; angle += 10.0f) {
-                if (numPoints < 8) {
-                    polygonPoints[numPoints].x = TR_arc_center.x + actualRadiusTop * cosf(DEG2RAD * angle);
-                    polygonPoints[numPoints].y = TR_arc_center.y + actualRadiusTop * sinf(DEG2RAD * angle);
-                    numPoints++;
-                }
+            // 270 to 360 degrees in 10 degree steps, read from the baked quarter-circle table
+            for (int i = 0; i <= 9 && numPoints < 8; i++) {
+                polygonPoints[numPoints++] = ArcTablePoint(arcDirs, i, 3, TR_arc_center, actualRadiusTop);
             }
         } else {
             if (numPoints < 8) { polygonPoints[numPoints++] = {currentCenterX + halfWidth, currentCenterY - halfHeight + topSlopeOffset / 2.0f}; }
@@ -168,14 +154,9 @@ public:
         
         // Bottom-right arc
         if (actualRadiusBottom > 0) {
-            float startAngle = 0.0f; // From right
-            float endAngle = 90.0f;  // To bottom
-            for (float angle = startAngle; angle <= endAngle; angle += 10.0f) {
-                 if (numPoints < 8) {
-                    polygonPoints[numPoints].x = BR_arc_center.x + actualRadiusBottom * cosf(DEG2RAD * angle);
-                    polygonPoints[numPoints].y = BR_arc_center.y + actualRadiusBottom * sinf(DEG2RAD * angle);
-                    numPoints++;
-                }
+            // 0 to 90 degrees in 10 degree steps, read from the baked quarter-circle table
+            for (int i = 0; i <= 9 && numPoints < 8; i++) {
+                polygonPoints[numPoints++] = ArcTablePoint(arcDirs, i, 0, BR_arc_center, actualRadiusBottom);
             }
         } else {
             if (numPoints < 8) { polygonPoints[numPoints++] = {currentCenterX + halfWidth, currentCenterY + halfHeight + bottomSlopeOffset / 2.0f}; }
@@ -183,14 +164,9 @@ public:
 
         // Bottom-left arc
         if (actualRadiusBottom > 0) {
-            float startAngle = 90.0f; // From bottom
-            float endAngle = 180.0f;  // To left
-            for (float angle = startAngle; angle <= endAngle; angle += 10.0f) {
-                if (numPoints < 8) {
-                    polygonPoints[numPoints].x = BL_arc_center.x + actualRadiusBottom * cosf(DEG2RAD * angle);
-                    polygonPoints[numPoints].y = BL_arc_center.y + actualRadiusBottom * sinf(DEG2RAD * angle);
-                    numPoints++;
-                }
+            // 90 to 180 degrees in 10 degree steps, read from the baked quarter-circle table
+            for (int i = 0; i <= 9 && numPoints < 8; i++) {
+                polygonPoints[numPoints++] = ArcTablePoint(arcDirs, i, 1, BL_arc_center, actualRadiusBottom);
             }
         } else {
              if (numPoints < 8) { polygonPoints[numPoints++] = {currentCenterX - halfWidth, currentCenterY + halfHeight - bottomSlopeOffset / 2.0f}; }
@@ -286,12 +262,12 @@ public:
 
         // Fill the rounded corners (solid sectors)
         if (actualRadiusTop > 0) {
-            DrawCircleSector(TL_arc_center, actualRadiusTop, 180, 270, 20, shapeColor); // Top-left
-            DrawCircleSector(TR_arc_center, actualRadiusTop, 270, 360, 20, shapeColor); // Top-right
+            DrawCircleSector(TL_arc_center, actualRadiusTop, 180, 270, ArcSegmentCount(actualRadiusTop), shapeColor); // Top-left
+            DrawCircleSector(TR_arc_center, actualRadiusTop, 270, 360, ArcSegmentCount(actualRadiusTop), shapeColor); // Top-right
         }
         if (actualRadiusBottom > 0) {
-            DrawCircleSector(BL_arc_center, actualRadiusBottom, 90, 180, 20, shapeColor); // Bottom-left
-            DrawCircleSector(BR_arc_center, actualRadiusBottom, 0, 90, 20, shapeColor); // Bottom-right
+            DrawCircleSector(BL_arc_center, actualRadiusBottom, 90, 180, ArcSegmentCount(actualRadiusBottom), shapeColor); // Bottom-left
+            DrawCircleSector(BR_arc_center, actualRadiusBottom, 0, 90, ArcSegmentCount(actualRadiusBottom), shapeColor); // Bottom-right
         }
 
         // Fill the rectangles connecting arcs to the main body, if any
@@ -315,12 +291,12 @@ public:
 
         // Draw the rounded corners wireframe on top of the fill
         if (actualRadiusTop > 0) {
-            DrawCircleSectorLines(TL_arc_center, actualRadiusTop, 180, 270, 20, BLACK); // Top-left
-            DrawCircleSectorLines(TR_arc_center, actualRadiusTop, 270, 360, 20, BLACK); // Top-right
+            DrawCircleSectorLines(TL_arc_center, actualRadiusTop, 180, 270, ArcSegmentCount(actualRadiusTop), BLACK); // Top-left
+            DrawCircleSectorLines(TR_arc_center, actualRadiusTop, 270, 360, ArcSegmentCount(actualRadiusTop), BLACK); // Top-right
         }
         if (actualRadiusBottom > 0) {
-            DrawCircleSectorLines(BL_arc_center, actualRadiusBottom, 90, 180, 20, BLACK); // Bottom-left
-            DrawCircleSectorLines(BR_arc_center, actualRadiusBottom, 0, 90, 20, BLACK); // Bottom-right
+            DrawCircleSectorLines(BL_arc_center, actualRadiusBottom, 90, 180, ArcSegmentCount(actualRadiusBottom), BLACK); // Bottom-left
+            DrawCircleSectorLines(BR_arc_center, actualRadiusBottom, 0, 90, ArcSegmentCount(actualRadiusBottom), BLACK); // Bottom-right
         }
 
         // Draw the conceptual inner rectangle boundaries (dotted lines from image)
@@ -388,14 +364,26 @@ int main() {
 
     ShapeConfig cfg = Preset_NeutralShape;
 
+    // The GUI edits cfg; the store holds what is drawn, with the colour packed to RGBA8
+    // only when a slider actually moved instead of cast on every draw
+    EyeConfigStore shapes;
+    shapes.Resize(1);
+    shapes.ScatterShapes(&cfg, 0, 1);
+    ShapeConfig packed = cfg;
+
     while (!WindowShouldClose()) {
+        if (memcmp(&cfg, &packed, sizeof(ShapeConfig)) != 0) {
+            shapes.ScatterShapes(&cfg, 0, 1);
+            packed = cfg;
+        }
+
         BeginDrawing();
         ClearBackground(DARKGRAY); // Changed background for better contrast
 
         // Draw the shape in the center
         float centerX = GetScreenWidth() / 2.0f;
         float centerY = GetScreenHeight() / 2.0f;
-        ShapeDrawer::Draw(centerX, centerY, cfg);
+        ShapeDrawer::Draw(centerX, centerY, shapes.Get(0), shapes.Colors()[0]);
 
         // --- GUI controls ---
         GuiSetStyle(DEFAULT, TEXT_SIZE, 16);
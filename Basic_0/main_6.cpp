@@ -4,6 +4,7 @@
 #include "raymath.h" // For Vector2 and geometric functions
 #include <algorithm>
 #include <cmath>
+#include "face/arc_lod.h"
 using namespace std;
 
 // --- Combined Configuration Struct (from user code) ---
@@ -60,6 +61,7 @@ public:
         DrawLineEx(p7_left_start, p8_left_end, lineThick, color);    
 
         // --- 4. Draw the Four Corner Arcs (Quarter Circles) ---
+        segments = ArcSegmentsOrAuto(segments, radius);
         DrawCircleSectorLines(centerTL, radius, 180, 270, segments, color); // Top-Left
         DrawCircleSectorLines(centerTR, radius, 270, 360, segments, color); // Top-Right
         DrawCircleSectorLines(centerBR, radius, 0, 90, segments, color);    // Bottom-Right
@@ -87,7 +89,7 @@ public:
         CustomRaylibDrawer::DrawRectangleRoundedLinesCustom(
             rec,
             ctrl.Roundness,
-            16,
+            0,
             ctrl.LineThickness,
             color
         );
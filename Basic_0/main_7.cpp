@@ -3,6 +3,7 @@
 #include "raygui.h"
 #include "raymath.h"
 #include <cmath>
+#include "face/arc_tables.h"
 
 // --- Configuration Struct for the Star ---
 struct StarConfig {
@@ -29,19 +30,23 @@ public:
         // 1. Define Vertices Array (10 vertices for the star points)
         Vector2 vertices[10];
         
-        // 2. Calculate Vertex Coordinates (The core math remains the same)
-        float angleStep = 360.0f / 10.0f; 
-        float currentAngle = cfg.RotationDeg - 90.0f; // Start at the top point
+        // 2. Calculate Vertex Coordinates from the baked star directions.
+        // Only the rotation needs trig, and only when the slider actually moved it.
+        static float cachedRotationDeg = 0.0f;
+        static Vector2 rotation = {1.0f, 0.0f}; // cos, sin of RotationDeg
+        if (cfg.RotationDeg != cachedRotationDeg) {
+            rotation = {cosf(cfg.RotationDeg * DEG2RAD), sinf(cfg.RotationDeg * DEG2RAD)};
+            cachedRotationDeg = cfg.RotationDeg;
+        }
 
+        const Vector2 *dirs = starTable<5>.dir;
         for (int i = 0; i < 10; i++) {
             float radius = (i % 2 == 0) ? cfg.OuterRadius : cfg.InnerRadius; // Alternating radii
-            
-            float angleRad = currentAngle * DEG2RAD;
 
-            vertices[i].x = cfg.CenterX + radius * cosf(angleRad);
-            vertices[i].y = cfg.CenterY + radius * sinf(angleRad);
-            
-            currentAngle += angleStep;
+            Vector2 d = {dirs[i].x * rotation.x - dirs[i].y * rotation.y,
+                         dirs[i].x * rotation.y + dirs[i].y * rotation.x};
+            vertices[i].x = cfg.CenterX + radius * d.x;
+            vertices[i].y = cfg.CenterY + radius * d.y;
         }
 
         // --- 3. Draw the FILLED Star using Triangulation ---
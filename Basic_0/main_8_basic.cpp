@@ -1,6 +1,7 @@
 #include "raylib.h"
 #include <algorithm>
 #include <cmath>
+#include "face/arc_lod.h"
 using namespace std;
 
 // --- Custom rounded rectangle drawer (FIXED) ---
@@ -59,7 +60,7 @@ void MyDrawRectangleRounded(Rectangle rec, float roundness, int segments, Color
         if (i == 2) { startAngle = 0; endAngle = 90; }    // BR
         if (i == 3) { startAngle = 90; endAngle = 180; }  // BL
         
-        DrawCircleSector(centers[i], radius, startAngle, endAngle, segments, color);
+        DrawCircleSector(centers[i], radius, startAngle, endAngle, ArcSegmentsOrAuto(segments, radius), color);
     }
 }
 
@@ -87,7 +88,7 @@ int main() {
         ClearBackground(DARKGRAY);
 
         // Draw the fixed custom rounded rectangle
-        MyDrawRectangleRounded(testRec, Roundness, 30, SKYBLUE);
+        MyDrawRectangleRounded(testRec, Roundness, 0, SKYBLUE);
         
         DrawText("My Custom Rounded Rectangle (FIXED)", 10, 10, 20, RAYWHITE);
         DrawText(TextFormat("Roundness: %.2f (use LEFT/RIGHT arrows)", Roundness), 10, screenHeight - 30, 20, RAYWHITE);
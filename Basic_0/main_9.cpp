@@ -1,5 +1,6 @@
 #include "raylib.h"
 #include <math.h> // For fminf
+#include "face/arc_lod.h"
 
 // MyDrawSlopedRoundedRectangle: Draws a custom shape with a sloped top edge and rounded corners
 // rec: The bounding box for the general shape (x, y, width, height)
@@ -73,9 +74,9 @@ void MyDrawSlopedRoundedRectangle(Rectangle rec, float radiusBottom, float radiu
 
 
     // C. Draw the bottom-left arc (quarter circle)
-    DrawCircleSector(centerBL_arc, radiusBottom, 90.0f, 180.0f, segments, color);
+    DrawCircleSector(centerBL_arc, radiusBottom, 90.0f, 180.0f, ArcSegmentsOrAuto(segments, radiusBottom), color);
     // D. Draw the bottom-right arc (quarter circle)
-    DrawCircleSector(centerBR_arc, radiusBottom, 0.0f, 90.0f, segments, color);
+    DrawCircleSector(centerBR_arc, radiusBottom, 0.0f, 90.0f, ArcSegmentsOrAuto(segments, radiusBottom), color);
 
 
     // E. Draw the top section, which involves the slope and top radii.
@@ -122,11 +123,11 @@ void MyDrawSlopedRoundedRectangle(Rectangle rec, float radiusBottom, float radiu
 
     // F. Draw the top-left arc
     Vector2 centerTL_arc = { rec.x + radiusTop, rec.y + radiusTop };
-    DrawCircleSector(centerTL_arc, radiusTop, 180.0f, 270.0f, segments, color);
+    DrawCircleSector(centerTL_arc, radiusTop, 180.0f, 270.0f, ArcSegmentsOrAuto(segments, radiusTop), color);
 
     // G. Draw the top-right arc (adjusted for slope)
     Vector2 centerTR_arc = { pTR.x - radiusTop, rec.y + radiusTop };
-    DrawCircleSector(centerTR_arc, radiusTop, 270.0f, 360.0f, segments, color);
+    DrawCircleSector(centerTR_arc, radiusTop, 270.0f, 360.0f, ArcSegmentsOrAuto(segments, radiusTop), color);
 
     // H. Fill the remaining left and right vertical strips (if not covered by main rect and arcs)
     // Left strip
@@ -174,7 +175,7 @@ int main()
     float radiusBottom = 40.0f; // Example bottom radius
     float radiusTop = 30.0f;    // Example top radius
     float slopeFactor = 0.2f;   // Example slope factor (positive makes top-right shift left)
-    int segments = 16;          // Arc segments
+    int segments = 0;           // Arc segments (0 = auto from radius)
 
     while (!WindowShouldClose())
     {
@@ -196,7 +197,7 @@ int main()
         if (IsKeyDown(KEY_T)) slopeFactor -= 0.005f;
         if (IsKeyDown(KEY_Y)) slopeFactor += 0.005f;
 
-        if (IsKeyDown(KEY_F)) segments = fmaxf(3, segments - 1);
+        if (IsKeyDown(KEY_F)) segments = fmaxf(0, segments - 1);
         if (IsKeyDown(KEY_G)) segments = fminf(360, segments + 1);
 
 
@@ -219,7 +220,7 @@ int main()
         DrawText(TextFormat("Radius Bottom: %.1f (Q/W)", radiusBottom), 10, 10, 20, BLACK);
         DrawText(TextFormat("Radius Top: %.1f (E/R)", radiusTop), 10, 40, 20, BLACK);
         DrawText(TextFormat("Slope Factor: %.2f (T/Y)", slopeFactor), 10, 70, 20, BLACK);
-        DrawText(TextFormat("Segments: %d (F/G)", segments), 10, 100, 20, BLACK);
+        DrawText((segments > 0) ? TextFormat("Segments: %d (F/G)", segments) : "Segments: auto (F/G)", 10, 100, 20, BLACK);
 
 
         EndDrawing();
@@ -0,0 +1,120 @@
+// Vertex counts of the adaptive arc LOD against the old fixed segment counts,
+// for the small Preset_Neutral eyes and the large 500x250 sloped demo shape.
+#include "face/arc_lod.h"
+#include "face/eye_mesh.h"
+#include "face/sloped_rect.h"
+#include <chrono>
+#include <stdio.h>
+
+// Segments raylib picked for DrawCircleSector(..., 0, ...), what main.cpp used before
+static int RaylibAutoSegments(float radius, float angle) {
+    float th = acosf(2 * powf(1 - 0.5f / radius, 2) - 1);
+    int segments = (int)(angle * ceilf(2 * 3.14159265f / th) / 360);
+    return segments > 0 ? segments : 1;
+}
+
+// Largest gap between a quarter arc of `segments` chords and the circle
+static float ArcSag(float radius, int segments) {
+    return radius * (1.0f - cosf(0.5f * 1.5707963f / segments));
+}
+
+// Filled eye: 4 sectors of `segments` triangles each
+static int EyeVertices(int segmentsTop, int segmentsBottom) {
+    return 2 * 3 * segmentsTop + 2 * 3 * segmentsBottom;
+}
+
+// Fan triangles all wind the same way (none flipped or folded over the centre)
+static bool FanIsSimple(const Vector2 *points, int count) {
+    for (int i = 1; i + 1 < count; i++) {
+        Vector2 a = { points[i].x - points[0].x, points[i].y - points[0].y };
+        Vector2 b = { points[i + 1].x - points[0].x, points[i + 1].y - points[0].y };
+        if (a.x * b.y - a.y * b.x > 1e-3f) return false;
+    }
+    return true;
+}
+
+// Read through volatiles so the timed calls can't be hoisted out of the loop
+static volatile float inputRadiusTop = 30.0f, inputSlope = 0.2f;
+static float sink;
+
+template <typename F>
+static double NanosPerCall(F f, int iterations) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+int main() {
+    const EyeConfig &eye = Preset_Neutral;
+    Rectangle shapeRec = { 150, 100, 500, 250 };
+    float radiusTop = 30.0f, radiusBottom = 40.0f;
+
+    printf("Tolerance: %.2f px\n\n", ARC_LOD_MAX_ERROR);
+    printf("%-34s %10s %10s\n", "shape / segment rule", "seg/corner", "vertices");
+
+    // Small eyes (Preset_Neutral: 50x40, radius 10)
+    int autoSeg = RaylibAutoSegments(eye.Radius_Top, 90);
+    int lodSeg = ArcSegmentCount(eye.Radius_Top);
+    EyeMesh mesh;
+    EyeMeshTessellate(mesh, eye);
+    printf("%-34s %10d %10d\n", "eye 50x40  raylib auto (main.cpp)", autoSeg, EyeVertices(autoSeg, autoSeg));
+    printf("%-34s %10d %10d\n", "eye 50x40  fixed 16 (main_13)", 16, EyeVertices(16, 16));
+    printf("%-34s %10d %10d\n", "eye 50x40  fixed 20 (main_5)", 20, EyeVertices(20, 20));
+    printf("%-34s %10d %10d\n", "eye 50x40  ArcSegmentCount", lodSeg, (int)mesh.triangles.size());
+    // main.cpp used raylib's auto rule, which is coarser than the LOD tolerance at this radius:
+    // the default eye gets more vertices, not fewer
+    printf("  main.cpp eye vs raylib auto: %+d vertices, sag %.2f px -> %.2f px\n",
+           (int)mesh.triangles.size() - EyeVertices(autoSeg, autoSeg), ArcSag(eye.Radius_Top, autoSeg), ArcSag(eye.Radius_Top, lodSeg));
+
+    // Large sloped shape (main_13 defaults)
+    static Vector2 points[SLOPED_RECT_MAX_POINTS];
+    int fixed16 = TessellateSlopedRoundedRectangle(shapeRec, radiusBottom, radiusTop, 0.2f, 16, points);
+    int fixed20 = TessellateSlopedRoundedRectangle(shapeRec, radiusBottom, radiusTop, 0.2f, 20, points);
+    int lod = TessellateSlopedRoundedRectangle(shapeRec, radiusBottom, radiusTop, 0.2f, 0, points);
+    printf("%-34s %10d %10d\n", "shape 500x250  fixed 16", 16, fixed16);
+    printf("%-34s %10d %10d\n", "shape 500x250  fixed 20", 20, fixed20);
+    printf("%-34s %6d/%-3d %10d\n", "shape 500x250  ArcSegmentCount", ArcSegmentCount(radiusTop), ArcSegmentCount(radiusBottom), lod);
+
+    // Same shape scaled down to eye size: fixed counts don't shrink, LOD does
+    Rectangle smallRec = { 0, 0, 50, 40 };
+    int small16 = TessellateSlopedRoundedRectangle(smallRec, 8, 6, 0.2f, 16, points);
+    int smallLod = TessellateSlopedRoundedRectangle(smallRec, 8, 6, 0.2f, 0, points);
+    printf("%-34s %10d %10d\n", "shape 50x40  fixed 16", 16, small16);
+    printf("%-34s %6d/%-3d %10d\n", "shape 50x40  ArcSegmentCount", ArcSegmentCount(6), ArcSegmentCount(8), smallLod);
+
+    // Degenerate slopes: steep factor (T/Y keys) and a narrow rect (main_11 A key)
+    const struct { Rectangle rec; float slope; const char *name; } steep[] = {
+        { shapeRec, 1.5f, "shape 500x250  slope 1.5" },
+        { shapeRec, 4.0f, "shape 500x250  slope 4.0" },
+        { { 0, 0, 30, 120 }, 1.5f, "shape 30x120  slope 1.5" },
+    };
+    bool ok = true;
+    for (const auto &c : steep) {
+        int n = TessellateSlopedRoundedRectangle(c.rec, radiusBottom, radiusTop, c.slope, 0, points);
+        bool simple = FanIsSimple(points, n);
+        ok = ok && simple;
+        printf("%-34s %10s %10d\n", c.name, simple ? "simple" : "FOLDED", n);
+    }
+
+    // Baked quarter-arc thresholds: the count must hold the tolerance and one fewer must not
+    // (checked in double; the float acosf rule drifts by a segment at large radii)
+    int violations = 0, acosfDiffers = 0;
+    for (float r = 1.0f; r < arcLodRadii.maxRadius[ARC_LOD_MAX_SEGMENTS]; r += 0.01f) {
+        int n = ArcSegmentCount(r);
+        double sag = r * (1.0 - cos(3.14159265358979 / (4.0 * n)));
+        double sagFewer = r * (1.0 - cos(3.14159265358979 / (4.0 * (n - 1))));
+        violations += sag > ARC_LOD_MAX_ERROR * 1.0001 || (n > 1 && sagFewer < ARC_LOD_MAX_ERROR * 0.9999);
+        acosfDiffers += n != ArcSegmentCountExact(r, 90.0f, ARC_LOD_MAX_ERROR);
+    }
+    ok = ok && violations == 0;
+    printf("ArcSegmentCount table: %d tolerance violations, %d off-by-one vs float acosf\n", violations, acosfDiffers);
+
+    double nsFixed = NanosPerCall([&] { sink += TessellateSlopedRoundedRectangle(shapeRec, radiusBottom, inputRadiusTop, inputSlope, 16, points) + points[5].x; }, 200000);
+    double nsLod = NanosPerCall([&] { sink += TessellateSlopedRoundedRectangle(shapeRec, radiusBottom, inputRadiusTop, inputSlope, 0, points) + points[5].x; }, 200000);
+    double nsCount = NanosPerCall([&] { sink += ArcSegmentCount(inputRadiusTop); }, 2000000);
+    double nsExact = NanosPerCall([&] { sink += ArcSegmentCountExact(inputRadiusTop, 90.0f, ARC_LOD_MAX_ERROR); }, 2000000);
+    printf("\nTessellate 500x250: fixed 16 %.0f ns, LOD %.0f ns\n", nsFixed, nsLod);
+    printf("Segment count per corner: table %.1f ns, acosf %.1f ns\n", nsCount, nsExact);
+    return ok && sink != 12345.0f ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+// Per-frame arc and star vertex generation: cosf/sinf per vertex (the old
+// ShapeDrawer / PolygonDrawer loops) against the constexpr direction tables.
+#include "face/arc_tables.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+// The tables are filled by the compiler, nothing runs at startup or per frame
+static_assert(quarterArcTables.dir[ArcTableOffset(9) + 9].y == 1.0f, "quarter table baked at compile time");
+static_assert(starTable<5>.dir[0].y == -1.0f, "star table baked at compile time");
+
+static volatile float inputRadius = 20.0f;
+static volatile float inputRotation = 15.0f;
+static float sink;
+
+// Every cosf/sinf in the generators below goes through these, so the table column is counted too
+static int trigCalls;
+static float CountedCos(float x) { trigCalls++; return cosf(x); }
+static float CountedSin(float x) { trigCalls++; return sinf(x); }
+
+// Old ShapeDrawer::Draw: four corners, 10 degree steps, cosf/sinf per vertex
+static void ArcsTrig(Vector2 *out, float radius) {
+    const float starts[4] = { 180.0f, 270.0f, 0.0f, 90.0f };
+    int n = 0;
+    for (int c = 0; c < 4; c++) {
+        for (float angle = starts[c]; angle <= starts[c] + 90.0f; angle += 10.0f) {
+            out[n].x = 100 + radius * CountedCos(3.14159265f / 180.0f * angle);
+            out[n].y = 100 + radius * CountedSin(3.14159265f / 180.0f * angle);
+            n++;
+        }
+    }
+}
+
+// Same points from the 9-segment table: scale and translate only
+static void ArcsFromTable(Vector2 *out, float radius) {
+    const Vector2 *dir = QuarterArcDirections(9);
+    const int quadrants[4] = { 2, 3, 0, 1 };
+    int n = 0;
+    for (int c = 0; c < 4; c++) {
+        for (int i = 0; i <= 9; i++) out[n++] = ArcTablePoint(dir, i, quadrants[c], Vector2{ 100, 100 }, radius);
+    }
+}
+
+// Old PolygonDrawer::DrawStar vertex loop
+static void StarTrig(Vector2 *out, float rotation) {
+    float angle = rotation - 90.0f;
+    for (int i = 0; i < 10; i++) {
+        float radius = (i % 2 == 0) ? 100.0f : 40.0f;
+        out[i].x = 400 + radius * CountedCos(angle * (3.14159265f / 180.0f));
+        out[i].y = 300 + radius * CountedSin(angle * (3.14159265f / 180.0f));
+        angle += 36.0f;
+    }
+}
+
+// Table star, rotation (cos, sin) computed once outside the per-frame path
+static void StarFromTable(Vector2 *out, Vector2 rotation) {
+    const Vector2 *dirs = starTable<5>.dir;
+    for (int i = 0; i < 10; i++) {
+        float radius = (i % 2 == 0) ? 100.0f : 40.0f;
+        out[i].x = 400 + radius * (dirs[i].x * rotation.x - dirs[i].y * rotation.y);
+        out[i].y = 300 + radius * (dirs[i].x * rotation.y + dirs[i].y * rotation.x);
+    }
+}
+
+template <typename F>
+static double NanosPerCall(F f, int iterations) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+int main() {
+    const int iterations = 2000000;
+    Vector2 a[40], b[40];
+
+    // Both paths must produce the same vertices
+    ArcsTrig(a, inputRadius);
+    ArcsFromTable(b, inputRadius);
+    float arcError = 0;
+    for (int i = 0; i < 40; i++) arcError = fmaxf(arcError, fmaxf(fabsf(a[i].x - b[i].x), fabsf(a[i].y - b[i].y)));
+
+    Vector2 rotation = { cosf(inputRotation * (3.14159265f / 180.0f)), sinf(inputRotation * (3.14159265f / 180.0f)) };
+    StarTrig(a, inputRotation);
+    StarFromTable(b, rotation);
+    float starError = 0;
+    for (int i = 0; i < 10; i++) starError = fmaxf(starError, fmaxf(fabsf(a[i].x - b[i].x), fabsf(a[i].y - b[i].y)));
+
+    // Calls per frame, counted on one run of each generator
+    int calls[4];
+    trigCalls = 0; ArcsTrig(a, inputRadius); calls[0] = trigCalls;
+    trigCalls = 0; ArcsFromTable(a, inputRadius); calls[1] = trigCalls;
+    trigCalls = 0; StarTrig(a, inputRotation); calls[2] = trigCalls;
+    trigCalls = 0; StarFromTable(a, rotation); calls[3] = trigCalls;
+
+    double arcsTrigNs = NanosPerCall([&] { ArcsTrig(a, inputRadius); sink += a[7].x; }, iterations);
+    double arcsTableNs = NanosPerCall([&] { ArcsFromTable(a, inputRadius); sink += a[7].x; }, iterations);
+    double starTrigNs = NanosPerCall([&] { StarTrig(a, inputRotation); sink += a[3].x; }, iterations);
+    double starTableNs = NanosPerCall([&] { StarFromTable(a, rotation); sink += a[3].x; }, iterations);
+
+    printf("%-28s %10s %10s %12s\n", "generator", "trig calls", "ns/frame", "max err px");
+    printf("%-28s %10d %10.1f %12s\n", "4 corner arcs, cosf/sinf", calls[0], arcsTrigNs, "-");
+    printf("%-28s %10d %10.1f %12.2e\n", "4 corner arcs, table", calls[1], arcsTableNs, arcError);
+    printf("%-28s %10d %10.1f %12s\n", "5-point star, cosf/sinf", calls[2], starTrigNs, "-");
+    printf("%-28s %10d %10.1f %12.2e\n", "5-point star, table", calls[3], starTableNs, starError);
+    return sink == 12345.0f;
+}
@@ -0,0 +1,141 @@
+// Baked vs live playback of canned animations (happy bounce, surprised) at 60 fps.
+// Live: evaluate the clip, then tessellate (EyeDrawer's mesh path) or rasterize and
+// pack for the OLED. Baked: blit a cell of a frame atlas, or apply one delta packet of
+// a 1-bpp stream. Baked frames are checked against live ones, in order and by random seek.
+#include "face/eye_bake.h"
+#include "face/eye_curve.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef std::chrono::steady_clock Clock;
+
+static double UsPerFrame(Clock::time_point a, Clock::time_point b, long frames) {
+    return std::chrono::duration<double, std::micro>(b - a).count() / frames;
+}
+
+int main() {
+    const float fps = 60.0f;
+    const int repeats = 20;
+
+    // Two canned clips on one track: a bouncing happy face, then a surprised one
+    EyeClipTrackData track;
+    EyeConfig up = Preset_Happy, down = Preset_Happy, surprised = Preset_Awe, blink = Preset_Neutral;
+    up.OffsetY = -8;
+    down.OffsetY = 4;
+    down.Height = 30;
+    surprised.Height = 48;
+    surprised.Width = 40;
+    surprised.Radius_Top = surprised.Radius_Bottom = 18;
+    blink.Height = 2;
+    blink.Radius_Top = blink.Radius_Bottom = 1;
+    float t = 0.0f;
+    track.Add(t, Preset_Neutral, EASE_IN_OUT_QUAD);
+    for (int b = 0; b < 6; b++) {
+        track.Add(t += 0.25f, up, EASE_IN_QUAD);
+        track.Add(t += 0.25f, down, EASE_OUT_BACK);
+    }
+    track.Add(t += 0.4f, Preset_Neutral, EASE_OUT_QUAD);
+    track.Add(t += 0.1f, blink, EASE_OUT_QUAD);
+    track.Add(t += 0.15f, surprised, EASE_OUT_BACK);
+    track.Add(t += 2.0f, surprised, EASE_IN_OUT_CUBIC);
+    track.Add(t += 0.5f, Preset_Neutral, EASE_LINEAR);
+    std::vector<uint8_t> image = EyeClipSerialize({ track });
+    EyeClipView clip;
+    if (!clip.Attach(image.data(), image.size())) return 1;
+    std::vector<EyeConfig> poses = EyeCurveSampleClip(clip, 0, fps);
+    const int frames = (int)poses.size();
+
+    // Bake
+    EyeBakeLayout layout;
+    EyeFrameAtlas atlas;
+    EyeFrameStream stream;
+    auto b0 = Clock::now();
+    EyeBakeAtlas(poses.data(), frames, fps, layout, atlas);
+    auto b1 = Clock::now();
+    EyeBakeStream(poses.data(), frames, fps, layout, 60, stream);
+    auto b2 = Clock::now();
+    printf("%d frames (%.1f s): atlas %dx%d (%.0f KB) in %.1f ms, stream %.1f KB in %.1f ms\n\n", frames, frames / fps,
+           atlas.canvas.width, atlas.canvas.height, atlas.canvas.pixels.size() / 1024.0, UsPerFrame(b0, b1, 1000),
+           stream.data.size() / 1024.0, UsPerFrame(b1, b2, 1000));
+
+    // Live paths
+    EyeMeshCache meshes;
+    SoftCanvas canvas(OLED_WIDTH, OLED_HEIGHT, SOFT_GRAY8);
+    OledFrame live;
+    size_t sink = 0;
+    auto l0 = Clock::now();
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < frames; i++) {
+            EyeConfig pose;
+            clip.Evaluate(0, i / fps, pose);
+            sink += meshes.Get(pose).triangles.size() + meshes.Get(EyeConfigRight(pose)).triangles.size();
+        }
+    }
+    auto l1 = Clock::now();
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < frames; i++) {
+            EyeConfig pose;
+            clip.Evaluate(0, i / fps, pose);
+            canvas.Clear(layout.background);
+            EyeBakeDraw(canvas, canvas.Bounds(), pose, layout);
+            OledEncodeCanvas(canvas, 127, live);
+            sink += live.bytes[i & 1023];
+        }
+    }
+    auto l2 = Clock::now();
+
+    // Baked paths
+    std::vector<uint8_t> blit(OLED_WIDTH * OLED_HEIGHT);
+    auto p0 = Clock::now();
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < frames; i++) {
+            atlas.CopyFrame(atlas.FrameAt(i / fps, true), blit.data());
+            sink += blit[i & 1023];
+        }
+    }
+    auto p1 = Clock::now();
+    EyeStreamPlayer player;
+    player.Attach(stream);
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < frames; i++) {
+            player.Seek(i);
+            sink += player.display.bytes[i & 1023];
+        }
+    }
+    auto p2 = Clock::now();
+
+    long total = (long)repeats * frames;
+    printf("%-34s %10s\n", "path", "us/frame");
+    printf("%-34s %10.2f\n", "live: evaluate + tessellate", UsPerFrame(l0, l1, total));
+    printf("%-34s %10.2f\n", "live: evaluate + rasterize + pack", UsPerFrame(l1, l2, total));
+    printf("%-34s %10.2f\n", "baked: atlas blit", UsPerFrame(p0, p1, total));
+    printf("%-34s %10.2f\n", "baked: 1-bpp stream, in order", UsPerFrame(p1, p2, total));
+
+    // Every frame against a live render, in order and by random seeks
+    bool ok = true;
+    player.Attach(stream);
+    std::vector<int> order(frames);
+    for (int i = 0; i < frames; i++) order[i] = i;
+    for (int i = 0; i < frames; i++) order.push_back(rand() % frames);
+    for (int i : order) {
+        canvas.Clear(layout.background);
+        EyeBakeDraw(canvas, canvas.Bounds(), poses[i], layout);
+        OledEncodeCanvas(canvas, 127, live);
+        atlas.CopyFrame(i, blit.data());
+        if (!player.Seek(i) || memcmp(player.display.bytes, live.bytes, OLED_FRAME_BYTES) != 0) ok = false;
+        if (memcmp(blit.data(), canvas.pixels.data(), blit.size()) != 0) ok = false;
+    }
+    // Empty clips and out-of-range seeks are refused, not decoded
+    EyeFrameAtlas emptyAtlas;
+    EyeFrameStream emptyStream;
+    EyeBakeAtlas(poses.data(), 0, fps, layout, emptyAtlas);
+    EyeBakeStream(poses.data(), 0, fps, layout, 60, emptyStream);
+    EyeStreamPlayer emptyPlayer;
+    emptyPlayer.Attach(emptyStream);
+    if (emptyAtlas.FrameAt(1.0f, true) != -1 || emptyPlayer.SeekTime(1.0f, true) || emptyPlayer.Seek(0)) ok = false;
+    if (player.Seek(-1) || player.Seek(frames)) ok = false;
+
+    printf("\n%s (checksum %zu)\n", ok ? "OK" : "MISMATCH", sink);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+// Outline generation for many eyes: scalar vs SSE2 vs AVX2 EyeBatch kernels.
+#include "face/eye_batch.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+int main() {
+    const int eyes = 10000;
+    const int frames = 200;
+
+    // A wall of faces cycling through the presets with a little variation
+    EyeBatch batch;
+    batch.Resize(eyes);
+    const EyeConfig presets[3] = { Preset_Neutral, Preset_Happy, Preset_Awe };
+    for (int i = 0; i < eyes; i++) {
+        EyeConfig cfg = presets[i % 3];
+        cfg.Height += (i % 7);
+        cfg.Radius_Top += (i % 5);
+        batch.Set(i, (float)(i % 100) * 120.0f, (float)(i / 100) * 80.0f, cfg);
+    }
+
+    EyeBatchVertices reference;
+    EyeBatchGenerate(batch, 0, reference, SIMD_SCALAR);
+    printf("%d eyes, %d segments/corner, %d vertices/eye, best level: %s\n\n",
+           eyes, reference.segments, reference.verticesPerEye, SimdLevelName(DetectSimdLevel()));
+    printf("%-8s %12s %14s %12s\n", "level", "us/batch", "Mvertices/s", "max diff");
+
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 }) {
+        if (level > DetectSimdLevel()) continue;
+
+        EyeBatchVertices out;
+        EyeBatchGenerate(batch, 0, out, level);
+        float diff = 0.0f;
+        for (size_t i = 0; i < out.x.size(); i++) {
+            diff = fmaxf(diff, fmaxf(fabsf(out.x[i] - reference.x[i]), fabsf(out.y[i] - reference.y[i])));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++) EyeBatchGenerate(batch, 0, out, level);
+        auto end = std::chrono::steady_clock::now();
+        double us = std::chrono::duration<double, std::micro>(end - start).count() / frames;
+
+        printf("%-8s %12.1f %14.1f %12.2e\n", SimdLevelName(level), us, out.x.size() / us, diff);
+    }
+    return 0;
+}
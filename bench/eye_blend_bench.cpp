@@ -0,0 +1,109 @@
+// Blend tree over a wall of faces: base expression + emotion override (slopes, radii) +
+// gaze (additive offsets) + blink (Height squash). Per-face AoS evaluation, the way a
+// single EyeConfig would be patched field by field, vs EyeBlendTree at each SIMD level.
+#include "face/eye_blend.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+int main() {
+    const int faces = 10000;
+    const int frames = 500;
+    const EyeConfig presets[3] = { Preset_Neutral, Preset_Happy, Preset_Awe };
+
+    EyeBlendTree tree;
+    tree.Resize(faces, Preset_Neutral);
+    int emotion = tree.AddLayer(EYE_BLEND_OVERRIDE, EYE_FIELDS_SLOPES | EYE_FIELD_BIT(EYE_FIELD_RADIUS_TOP) | EYE_FIELD_BIT(EYE_FIELD_RADIUS_BOTTOM));
+    int gaze = tree.AddLayer(EYE_BLEND_ADD, EYE_FIELDS_GAZE);
+    int blink = tree.AddLayer(EYE_BLEND_MULTIPLY, EYE_FIELD_BIT(EYE_FIELD_HEIGHT));
+
+    // Same inputs kept AoS for the baseline
+    std::vector<EyeConfig> base(faces), emotionCfg(faces);
+    std::vector<float> emotionW(faces), gazeX(faces), gazeY(faces), gazeW(faces), blinkW(faces);
+    for (int i = 0; i < faces; i++) {
+        base[i] = presets[i % 3];
+        base[i].Inverse_Offset_Top = (i & 1);
+        emotionCfg[i] = presets[(i + 1) % 3];
+        emotionW[i] = (i % 11) / 10.0f;
+        gazeX[i] = (i % 21) - 10.0f;
+        gazeY[i] = (i % 7) - 3.0f;
+        gazeW[i] = (i % 5) / 4.0f;
+        blinkW[i] = (i % 13) / 12.0f;
+
+        tree.SetBase(i, base[i]);
+        tree.SetValues(emotion, i, emotionCfg[i]);
+        tree.SetWeight(emotion, i, emotionW[i]);
+        tree.SetValue(gaze, EYE_FIELD_OFFSET_X, i, gazeX[i]);
+        tree.SetValue(gaze, EYE_FIELD_OFFSET_Y, i, gazeY[i]);
+        tree.SetWeight(gaze, i, gazeW[i]);
+        tree.SetValue(blink, EYE_FIELD_HEIGHT, i, 0.05f);
+        tree.SetWeight(blink, i, blinkW[i]);
+    }
+
+    // Baseline: each face patches its own EyeConfig, layer by layer and field by field
+    struct AosLayer { EyeBlendMode mode; uint32_t mask; std::vector<EyeConfig> values; std::vector<float> weights; };
+    std::vector<AosLayer> aos = {
+        { EYE_BLEND_OVERRIDE, EYE_FIELDS_SLOPES | EYE_FIELD_BIT(EYE_FIELD_RADIUS_TOP) | EYE_FIELD_BIT(EYE_FIELD_RADIUS_BOTTOM), emotionCfg, emotionW },
+        { EYE_BLEND_ADD, EYE_FIELDS_GAZE, std::vector<EyeConfig>(faces), gazeW },
+        { EYE_BLEND_MULTIPLY, EYE_FIELD_BIT(EYE_FIELD_HEIGHT), std::vector<EyeConfig>(faces), blinkW },
+    };
+    for (int i = 0; i < faces; i++) {
+        aos[1].values[i].OffsetX = gazeX[i];
+        aos[1].values[i].OffsetY = gazeY[i];
+        aos[2].values[i].Height = 0.05f;
+    }
+
+    std::vector<EyeConfig> reference(faces), out(faces);
+    auto perFace = [&]() {
+        for (int i = 0; i < faces; i++) {
+            EyeConfig cfg = base[i];
+            float *o = &cfg.OffsetX;
+            for (const AosLayer &layer : aos) {
+                const float *v = &layer.values[i].OffsetX;
+                float w = layer.weights[i];
+                for (int k = 0; k < EYE_FIELD_COUNT; k++) {
+                    if (!(layer.mask & EYE_FIELD_BIT(k))) continue;
+                    if (layer.mode == EYE_BLEND_ADD) o[k] += v[k] * w;
+                    else if (layer.mode == EYE_BLEND_MULTIPLY) o[k] *= 1.0f + (v[k] - 1.0f) * w;
+                    else o[k] += (v[k] - o[k]) * w;
+                }
+            }
+            reference[i] = cfg;
+        }
+    };
+
+    perFace();
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) perFace();
+    auto end = std::chrono::steady_clock::now();
+    printf("%d faces, %d layers, best level: %s\n\n", faces, tree.LayerCount(), SimdLevelName(DetectSimdLevel()));
+    printf("%-8s %12s %14s %12s\n", "level", "us/frame", "Mfaces/s", "max diff");
+    double us = std::chrono::duration<double, std::micro>(end - start).count() / frames;
+    printf("%-8s %12.1f %14.1f %12s\n", "per-face", us, faces / us, "-");
+
+    bool ok = true;
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 }) {
+        if (level > DetectSimdLevel()) continue;
+
+        tree.Evaluate(out.data(), level);
+        float diff = 0.0f;
+        for (int i = 0; i < faces; i++) {
+            const float *a = &out[i].OffsetX, *b = &reference[i].OffsetX;
+            for (int k = 0; k < EYE_FIELD_COUNT; k++) diff = fmaxf(diff, fabsf(a[k] - b[k]));
+            if (out[i].Inverse_Offset_Top != reference[i].Inverse_Offset_Top) ok = false;
+        }
+        if (diff > 1e-4f) ok = false;
+
+        start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++) tree.Evaluate(out.data(), level);
+        end = std::chrono::steady_clock::now();
+        us = std::chrono::duration<double, std::micro>(end - start).count() / frames;
+        printf("%-8s %12.1f %14.1f %12.2e\n", SimdLevelName(level), us, faces / us, diff);
+    }
+
+    if (!ok) {
+        printf("\nMISMATCH against the per-face blend\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Eye clip files: write a large clip, then time opening it (mmap + validation) and
+// random-access evaluation. Evaluated poses are checked against the authored keys.
+#include "face/eye_clip.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "eye_clip_bench.eyec";
+    const int tracks = 400, keys = 2000;
+    const EyeConfig presets[3] = { Preset_Neutral, Preset_Happy, Preset_Awe };
+
+    // Every 0.1 s a new preset, eases cycling
+    std::vector<EyeClipTrackData> data(tracks);
+    for (int t = 0; t < tracks; t++) {
+        for (int k = 0; k < keys; k++) data[t].Add(k * 0.1f, presets[(t + k) % 3], (EaseType)(k % EASE_COUNT));
+    }
+    auto start = std::chrono::steady_clock::now();
+    if (!EyeClipWrite(path, data)) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    auto written = std::chrono::steady_clock::now();
+
+    EyeClipFile file;
+    if (!file.Open(path)) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    auto opened = std::chrono::steady_clock::now();
+    const EyeClipView &clip = file.View();
+
+    // Clips without tracks are never written or attached
+    EyeClipHeader empty = { EYE_CLIP_MAGIC, EYE_CLIP_VERSION, 0, 0.0f };
+    bool ok = EyeClipSerialize({}).empty() && !EyeClipView().Attach(&empty, sizeof(empty));
+
+    // Exact on keys, eased in between
+    ok = ok && clip.TrackCount() == tracks;
+    float maxError = 0.0f;
+    for (int t = 0; t < tracks && ok; t += 37) {
+        for (int k = 0; k + 1 < keys; k += 13) {
+            EyeConfig onKey, between;
+            clip.Evaluate(t, data[t].times[k], onKey);
+            float u = 0.3f;
+            clip.Evaluate(t, data[t].times[k] + u * 0.1f, between);
+            EyeConfig expected = EyeConfigLerp(data[t].keys[k], data[t].keys[k + 1], EaseApply(data[t].ease[k], u));
+            for (int f = 0; f < 8; f++) {
+                maxError = fmaxf(maxError, fabsf((&onKey.OffsetX)[f] - (&data[t].keys[k].OffsetX)[f]));
+                maxError = fmaxf(maxError, fabsf((&between.OffsetX)[f] - (&expected.OffsetX)[f]));
+            }
+        }
+    }
+    ok = ok && maxError < 1e-3f;
+
+    // Random seeks across the whole clip
+    const int seeks = 1000000;
+    std::vector<float> times(4096);
+    for (float &t : times) t = clip.Duration() * (rand() / (float)RAND_MAX);
+    EyeConfig pose;
+    float sink = 0.0f;
+    auto seekStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < seeks; i++) {
+        clip.Evaluate(i % tracks, times[i & 4095], pose);
+        sink += pose.Height;
+    }
+    auto seekEnd = std::chrono::steady_clock::now();
+
+    long size = (long)(sizeof(EyeClipHeader) + tracks * (sizeof(EyeClipTrack) + keys * (sizeof(float) + sizeof(EyeClipKey))));
+    printf("%d tracks x %d keys, %.1f MB, %.0f s of animation\n", tracks, keys, size / 1048576.0, clip.Duration());
+    printf("write:    %10.2f ms\n", std::chrono::duration<double, std::milli>(written - start).count());
+    printf("open:     %10.2f us (mmap + offset checks)\n", std::chrono::duration<double, std::micro>(opened - written).count());
+    printf("evaluate: %10.1f ns per seek + pose\n", std::chrono::duration<double, std::nano>(seekEnd - seekStart).count() / seeks);
+    printf("max error vs authored keys: %.2e (checksum %.0f)\n", maxError, sink);
+    printf("%s\n", ok ? "OK" : "MISMATCH");
+
+    file.Close();
+    remove(path);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+// Curve-compressed clips: dense 60 fps performances (idle blinks, squints and glances
+// over expression changes every few seconds) compressed to 16-bit piecewise-linear
+// keys. Reports size against the dense EyeConfig frames, the worst error per field on
+// and between frames, and sample cost for clips from one minute to an hour.
+#include "face/eye_curve.h"
+#include "face/eye_idle.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+static std::vector<EyeConfig> Perform(float seconds, float fps, uint32_t seed) {
+    const EyeConfig presets[3] = { Preset_Neutral, Preset_Happy, Preset_Awe };
+    EyeIdleScheduler idle;
+    idle.Resize(1, Preset_Neutral);
+    std::vector<EyeConfig> frames((size_t)(seconds * fps) + 1);
+    float nextChange = 0.0f;
+    for (size_t i = 0; i < frames.size(); i++) {
+        float t = i / fps;
+        if (t >= nextChange) {
+            seed = seed * 1664525u + 1013904223u;
+            EyeConfig cfg = presets[(seed >> 8) % 3];
+            cfg.Inverse_Offset_Top = (seed >> 12) & 1;
+            idle.SetExpression(0, cfg, 0.3f, (EaseType)((seed >> 16) % EASE_COUNT));
+            nextChange = t + 2.0f + (seed >> 20) % 5;
+        }
+        if (i > 0) idle.Update(1.0f / fps);
+        frames[i] = idle.Pose(0);
+    }
+    return frames;
+}
+
+int main() {
+    const float fps = 60.0f;
+    const EyeCurveOptions options;
+    const char *fields[8] = { "OffsetX", "OffsetY", "Height", "Width", "Slope_Top", "Slope_Bottom", "Radius_Top", "Radius_Bottom" };
+    bool ok = true;
+
+    printf("%-8s %10s %12s %10s %8s %8s %12s\n", "clip", "frames", "dense KB", "curve KB", "ratio", "keys", "ns/sample");
+    std::vector<float> worst(8, 0.0f);
+    for (float minutes : { 1.0f, 10.0f, 60.0f }) {
+        std::vector<EyeConfig> frames = Perform(minutes * 60.0f, fps, 7);
+        EyeCurveClip clip;
+        clip.Compress(frames.data(), (int)frames.size(), fps, options);
+
+        // Round trip through the serialized form
+        std::vector<uint8_t> image = clip.Serialize();
+        EyeCurveClip loaded;
+        if (!loaded.Load(image.data(), image.size())) {
+            printf("load failed\n");
+            return 1;
+        }
+
+        // A bucket pointing past its frames must not load
+        if (minutes == 1.0f) {
+            std::vector<uint8_t> corrupt = image;
+            EyeCurveBucket bad = { 0, 5 };
+            memcpy(&corrupt[sizeof(EyeCurveHeader) + EYE_CURVE_CHANNELS * sizeof(EyeCurveChannel)], &bad, sizeof(bad));
+            EyeCurveClip rejected;
+            EyeConfig untouched = Preset_Neutral;
+            rejected.Sample(1.0f, untouched);
+            if (rejected.Load(corrupt.data(), corrupt.size()) || rejected.Valid() || untouched.Width != Preset_Neutral.Width) ok = false;
+        }
+
+        // On every frame and halfway between frames, against the dense track
+        for (size_t i = 0; i < frames.size(); i++) {
+            EyeConfig pose = {};
+            loaded.SampleFrame((uint32_t)i, 0.0f, pose);
+            if (EyeCurveFlags(pose) != EyeCurveFlags(frames[i])) ok = false;
+            for (int k = 0; k < 8; k++) worst[k] = fmaxf(worst[k], fabsf((&pose.OffsetX)[k] - (&frames[i].OffsetX)[k]));
+            if (i + 1 < frames.size()) {
+                loaded.SampleFrame((uint32_t)i, 0.5f, pose);
+                for (int k = 0; k < 8; k++) {
+                    float mid = 0.5f * ((&frames[i].OffsetX)[k] + (&frames[i + 1].OffsetX)[k]);
+                    worst[k] = fmaxf(worst[k], fabsf((&pose.OffsetX)[k] - mid));
+                }
+            }
+        }
+
+        // Random seeks, by time as playback does
+        const int samples = 1000000;
+        std::vector<float> times(4096);
+        uint32_t rng = 99;
+        for (float &t : times) {
+            rng = rng * 1664525u + 1013904223u;
+            t = loaded.Duration() * ((rng >> 8) / 16777216.0f);
+        }
+        EyeConfig pose = {};
+        float sink = 0.0f;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < samples; i++) {
+            loaded.Sample(times[i & 4095], pose);
+            sink += pose.Height;
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / samples;
+
+        int keys = 0;
+        for (int c = 0; c < EYE_CURVE_CHANNELS; c++) keys += loaded.KeyCount(c);
+        double dense = frames.size() * sizeof(EyeConfig);
+        double ratio = dense / image.size();
+        if (ratio < 10.0) ok = false;
+        printf("%-5.0f min %10zu %12.1f %10.1f %7.1fx %8d %12.1f%s\n", minutes, frames.size(), dense / 1024, image.size() / 1024.0, ratio, keys, ns, sink == 0.0f ? " " : "");
+    }
+
+    printf("\n%-14s %12s %12s\n", "field", "max error", "tolerance");
+    for (int k = 0; k < 8; k++) {
+        printf("%-14s %12.5f %12.5f\n", fields[k], worst[k], options.tolerance[k]);
+        if (worst[k] > options.tolerance[k] * 1.01f + 1e-5f) ok = false;
+    }
+
+    if (!ok) {
+        printf("\nFAILED (ratio under 10x, error over tolerance or flags wrong)\n");
+        return 1;
+    }
+    return 0;
+}
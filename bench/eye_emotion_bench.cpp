@@ -0,0 +1,78 @@
+// Valence/arousal lookups for a crowd whose emotions drift every frame: the grid's
+// bilinear lookup (single and batched) vs blending the anchors
+// directly per query. Checks that anchors come back exactly, that the batch path
+// matches the single one, and how far the grid strays from the direct blend.
+#include "face/eye_emotion.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+int main() {
+    const int faces = 10000;
+    const int frames = 200;
+    const int anchorCount = sizeof(Emotion_DefaultAnchors) / sizeof(Emotion_DefaultAnchors[0]);
+    EmotionGrid grid;
+    bool ok = true;
+
+    // Anchors are reproduced, flags included
+    for (const EmotionAnchor &a : Emotion_DefaultAnchors) {
+        EyeConfig cfg = grid.Lookup(a.valence, a.arousal);
+        for (int k = 0; k < 8; k++) {
+            if (fabsf((&cfg.OffsetX)[k] - (&a.cfg.OffsetX)[k]) > 1e-4f) ok = false;
+        }
+        if (cfg.Inverse_Offset_Top != a.cfg.Inverse_Offset_Top) ok = false;
+    }
+    printf("anchors reproduced: %s\n", ok ? "yes" : "NO");
+
+    // Emotions wandering around the plane
+    std::vector<float> valence(faces), arousal(faces);
+    for (int i = 0; i < faces; i++) {
+        valence[i] = sinf(i * 0.37f);
+        arousal[i] = cosf(i * 0.23f);
+    }
+    std::vector<EyeConfig> reference(faces), out(faces);
+    float gridError = 0.0f;
+    for (int i = 0; i < faces; i++) {
+        grid.Lookup(valence[i], arousal[i], reference[i]);
+        EyeConfig direct = {};
+        EmotionBlendAnchors(Emotion_DefaultAnchors, anchorCount, valence[i], arousal[i], direct);
+        for (int k = 0; k < 8; k++) gridError = fmaxf(gridError, fabsf((&direct.OffsetX)[k] - (&reference[i].OffsetX)[k]));
+    }
+
+    typedef std::chrono::steady_clock Clock;
+    float sink = 0.0f;
+    auto t0 = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < faces; i++) {
+            EyeConfig cfg;
+            EmotionBlendAnchors(Emotion_DefaultAnchors, anchorCount, valence[i], arousal[i] * (1.0f - f * 1e-4f), cfg);
+            sink += cfg.Height;
+        }
+    }
+    auto t1 = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < faces; i++) sink += grid.Lookup(valence[i], arousal[i] * (1.0f - f * 1e-4f)).Height;
+    }
+    auto t2 = Clock::now();
+    double directNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)faces * frames);
+    double gridNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / ((double)faces * frames);
+
+    printf("%d faces, %d anchors, %dx%d grid\n\n", faces, anchorCount, grid.Resolution(), grid.Resolution());
+    printf("%-16s %12s %12s\n", "path", "ns/face", "max diff");
+    printf("%-16s %12.1f %12s\n", "direct blend", directNs, "-");
+    printf("%-16s %12.1f %12.3f\n", "grid lookup", gridNs, gridError);
+    grid.LookupBatch(valence.data(), arousal.data(), out.data(), faces);
+    float diff = 0.0f;
+    for (int i = 0; i < faces; i++) {
+        for (int k = 0; k < 8; k++) diff = fmaxf(diff, fabsf((&out[i].OffsetX)[k] - (&reference[i].OffsetX)[k]));
+        if (out[i].Inverse_Offset_Top != reference[i].Inverse_Offset_Top) ok = false;
+    }
+    if (diff > 1e-4f) ok = false;
+
+    auto b0 = Clock::now();
+    for (int f = 0; f < frames; f++) grid.LookupBatch(valence.data(), arousal.data(), out.data(), faces);
+    auto b1 = Clock::now();
+    printf("%-16s %12.1f %12.2e\n", "batch", std::chrono::duration<double, std::nano>(b1 - b0).count() / ((double)faces * frames), diff);
+    printf("\n%s (checksum %.0f)\n", ok ? "OK" : "MISMATCH", sink);
+    return ok ? 0 : 1;
+}
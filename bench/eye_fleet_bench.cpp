@@ -0,0 +1,93 @@
+// CPU side of the fleet dashboard: geometry for N faces whose expressions all change
+// every frame. Per face: EyeDrawer's mesh path (tessellate both eyes, the cache can't
+// help when every face differs) and ~20 raylib calls per face to submit. Batched:
+// EyeFleetBuild writes one RL_TRIANGLES list that rlgl sends in a few draw calls.
+// Checks that every fan rim matches EyeOutline for the same face.
+#include "face/eye_emotion.h"
+#include "face/eye_fleet.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+typedef std::chrono::steady_clock Clock;
+
+// rlgl's default batch: RL_DEFAULT_BATCH_BUFFER_ELEMENTS quads of 4 vertices
+static const int RlglBatchVertices = 8192 * 4;
+// EyeDrawer::Draw before the mesh cache: edges, corner sectors and slope outlines, two eyes
+static const int RaylibCallsPerFace = 20;
+
+int main() {
+    const int counts[] = { 1000, 2500, 5000, 10000, 20000 };
+    const float screenWidth = 1920.0f, screenHeight = 1080.0f;
+    EmotionGrid emotions;
+    bool ok = true;
+
+    printf("%-7s %5s %4s %10s %12s %12s %11s %11s %8s\n", "faces", "cell", "segs", "vertices", "per-face",
+           "batched", "per-face ms", "batched ms", "speedup");
+    printf("%-7s %5s %4s %10s %12s %12s\n", "", "px", "", "", "rl calls", "draw calls");
+    for (int count : counts) {
+        EyeFleetLayout layout = EyeFleetGrid(count, screenWidth, screenHeight);
+        std::vector<float> valence(count), arousal(count);
+        std::vector<EyeConfig> cfgs(count);
+        EyeFleetMesh mesh;
+        const int frames = 20;
+
+        // Per face: what EyeDrawer::DrawPair does on a cache miss
+        EyeMesh left, right;
+        EyeFleetScratch scratch;
+        size_t sink = 0;
+        double perFaceMs = 0.0, batchedMs = 0.0;
+        for (int f = 0; f < frames; f++) {
+            for (int i = 0; i < count; i++) {
+                valence[i] = sinf(i * 0.37f + f * 0.05f);
+                arousal[i] = cosf(i * 0.23f + f * 0.03f);
+            }
+            emotions.LookupBatch(valence.data(), arousal.data(), cfgs.data(), count);
+
+            auto t0 = Clock::now();
+            float s = layout.Scale();
+            for (int i = 0; i < count; i++) {
+                EyeMeshTessellate(left, EyeFleetScaled(cfgs[i], s));
+                EyeMeshTessellate(right, EyeFleetScaled(EyeConfigRight(cfgs[i]), s));
+                sink += left.triangles.size() + right.lines.size();
+            }
+            auto t1 = Clock::now();
+            EyeFleetBuild(cfgs.data(), count, layout, mesh, scratch);
+            auto t2 = Clock::now();
+            perFaceMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
+            batchedMs += std::chrono::duration<double, std::milli>(t2 - t1).count();
+        }
+        perFaceMs /= frames;
+        batchedMs /= frames;
+
+        // Fan rims against EyeOutline, both eyes of every face
+        float s = layout.Scale();
+        int perEye = mesh.verticesPerFace / 6;
+        float maxError = 0.0f;
+        Vector2 outline[4 * (ARC_TABLE_MAX_SEGMENTS + 1)];
+        for (int i = 0; i < count; i++) {
+            Vector2 c = layout.FaceCenter(i);
+            for (int eye = 0; eye < 2; eye++) {
+                EyeConfig cfg = EyeFleetScaled(eye ? EyeConfigRight(cfgs[i]) : cfgs[i], s);
+                int n = EyeOutline(cfg, c.x + (eye ? 1 : -1) * layout.spacing * s, c.y, mesh.segments, outline);
+                if (n != perEye) ok = false;
+                const Vector2 *tri = mesh.Face(i) + eye * perEye * 3;
+                for (int v = 0; v < perEye && v < n; v++) {
+                    maxError = fmaxf(maxError, fabsf(tri[v * 3 + 2].x - outline[v].x));
+                    maxError = fmaxf(maxError, fabsf(tri[v * 3 + 2].y - outline[v].y));
+                }
+            }
+        }
+        if (maxError > 1e-3f) ok = false;
+
+        // rlgl flushes whenever the next face would overflow its buffer
+        int facesPerDraw = RlglBatchVertices / mesh.verticesPerFace;
+        int draws = (count + facesPerDraw - 1) / facesPerDraw;
+        printf("%-7d %5.0f %4d %10zu %12d %12d %11.2f %11.2f %7.1fx%s\n", count, layout.cellWidth, mesh.segments,
+               mesh.vertices.size(), count * RaylibCallsPerFace, draws, perFaceMs, batchedMs, perFaceMs / batchedMs,
+               maxError > 1e-3f ? "  RIM MISMATCH" : "");
+        if (sink == 0) ok = false;
+    }
+    printf("\n%s\n", ok ? "OK" : "MISMATCH");
+    return ok ? 0 : 1;
+}
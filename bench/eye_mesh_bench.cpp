@@ -0,0 +1,116 @@
+// Right-eye mesh reuse: for every preset and Inverse_Offset_* combination, the left
+// mesh moved or mirrored as EyeMeshReuseFor decides must be the mesh EyeMeshTessellate
+// builds for EyeConfigRight (same triangles and segments, in any order). Also times
+// tessellating the right eye against reusing the left one.
+#include "face/eye_mesh.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+static const float Tolerance = 1e-3f;
+
+static bool Near(Vector2 a, Vector2 b) {
+    return fabsf(a.x - b.x) <= Tolerance && fabsf(a.y - b.y) <= Tolerance;
+}
+
+static float Cross(Vector2 a, Vector2 b, Vector2 c) {
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+// The left mesh as DrawPair submits it for the right eye, centred on (0, 0): x negated
+// and two vertices of each triangle swapped when mirrored
+static EyeMesh ReusedMesh(const EyeMesh &left, bool mirror) {
+    EyeMesh out;
+    float sx = mirror ? -1.0f : 1.0f;
+    for (const Vector2 &v : left.lines) out.lines.push_back({ sx * v.x, v.y });
+    for (size_t i = 0; i + 2 < left.triangles.size(); i += 3) {
+        const Vector2 &a = left.triangles[i];
+        const Vector2 &b = left.triangles[mirror ? i + 2 : i + 1];
+        const Vector2 &c = left.triangles[mirror ? i + 1 : i + 2];
+        out.triangles.insert(out.triangles.end(), { { sx * a.x, a.y }, { sx * b.x, b.y }, { sx * c.x, c.y } });
+    }
+    return out;
+}
+
+// Every primitive of got (n vertices each) matches a distinct one of want: segments in
+// either direction, triangles by vertex set with the same winding
+static bool SamePrimitives(const std::vector<Vector2> &got, const std::vector<Vector2> &want, int n) {
+    if (got.size() != want.size()) return false;
+    std::vector<bool> used(want.size() / n, false);
+    for (size_t i = 0; i < got.size(); i += n) {
+        bool found = false;
+        for (size_t j = 0; j < want.size() && !found; j += n) {
+            if (used[j / n]) continue;
+            bool match = true;
+            for (int k = 0; k < n && match; k++) {
+                bool any = false;
+                for (int m = 0; m < n; m++) any |= Near(got[i + k], want[j + m]);
+                match = any;
+            }
+            if (match && n == 3) match = (Cross(got[i], got[i + 1], got[i + 2]) > 0) == (Cross(want[j], want[j + 1], want[j + 2]) > 0);
+            if (match) used[j / n] = found = true;
+        }
+        if (!found) return false;
+    }
+    return true;
+}
+
+int main() {
+    struct { const char *name; const EyeConfig *cfg; } presets[] = {
+        { "Preset_Neutral", &Preset_Neutral }, { "Preset_Awe", &Preset_Awe },
+        { "Preset_Happy", &Preset_Happy }, { "Preset_Sad", &Preset_Sad },
+        { "Preset_Angry", &Preset_Angry }, { "Preset_Surprised", &Preset_Surprised },
+        { "Preset_Sleepy", &Preset_Sleepy }, { "Preset_Excited", &Preset_Excited },
+        { "Preset_Content", &Preset_Content },
+    };
+    const char *reuseNames[] = { "translate", "mirror", "none" };
+    bool ok = true;
+    int reused = 0, total = 0;
+
+    printf("%-18s %7s %5s %10s %10s\n", "preset", "offsetX", "flags", "reuse", "check");
+    for (auto &p : presets) {
+        for (int flags = 0; flags < 4; flags++) {
+            // Off-centre copy too, so mirroring has an OffsetX to flip
+            for (float offsetX : { p.cfg->OffsetX, p.cfg->OffsetX + 6.5f }) {
+                EyeConfig cfg = *p.cfg;
+                cfg.OffsetX = offsetX;
+                cfg.Inverse_Offset_Top = (flags & 1) != 0;
+                cfg.Inverse_Offset_Bottom = (flags & 2) != 0;
+                EyeConfig right = EyeConfigRight(cfg);
+                EyeMeshReuse reuse = EyeMeshReuseFor(cfg, right);
+                total++;
+                if (reuse == EYE_REUSE_NONE) continue;
+                reused++;
+
+                EyeMesh left, want;
+                EyeMeshTessellate(left, cfg);
+                EyeMeshTessellate(want, right);
+                EyeMesh got = ReusedMesh(left, reuse == EYE_REUSE_MIRROR);
+                bool same = SamePrimitives(got.lines, want.lines, 2) && SamePrimitives(got.triangles, want.triangles, 3);
+                ok &= same;
+                printf("%-18s %7.1f %5d %10s %10s\n", p.name, offsetX, flags, reuseNames[reuse], same ? "ok" : "MISMATCH");
+            }
+        }
+    }
+    printf("\n%d of %d right eyes reuse the left mesh\n", reused, total);
+
+    // Cost the reuse saves per frame on a cache miss: tessellating the right eye
+    const int iterations = 20000;
+    EyeConfig cfg = Preset_Surprised;
+    cfg.OffsetX = 6.5f;
+    cfg.Inverse_Offset_Top = cfg.Inverse_Offset_Bottom = true;
+    EyeMesh mesh;
+    size_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        cfg.Height = 44.0f + (i & 7);
+        EyeMeshTessellate(mesh, EyeConfigRight(cfg));
+        sink += mesh.triangles.size();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+    printf("right eye tessellate: %.1f ns (reuse: none) [%zu]\n", ns, sink);
+
+    printf("\n%s\n", ok ? "OK" : "MISMATCH");
+    return ok ? 0 : 1;
+}
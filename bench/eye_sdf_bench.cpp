@@ -0,0 +1,129 @@
+// Eye signed distance field: agreement with the EyeOutline polygon that EyeDrawer::Draw
+// fills, scalar vs SSE2 vs AVX2 row kernels, and SDF fill vs polygon fill.
+// Exits non-zero if the SDF and the outline disagree.
+#include "face/eye_sdf.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Even-odd test against a tessellated outline
+static bool InsidePolygon(const Vector2 *points, int count, float x, float y) {
+    bool inside = false;
+    for (int i = 0, j = count - 1; i < count; j = i++) {
+        if ((points[i].y > y) != (points[j].y > y) &&
+            x < points[i].x + (y - points[i].y) * (points[j].x - points[i].x) / (points[j].y - points[i].y)) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+// Corner octagon (the outline at one segment per arc) turns the same way at every
+// vertex and holds the four arc centres, so no corner sector pokes through an edge
+static bool WellFormedOutline(const EyeConfig &cfg) {
+    Vector2 p[8];
+    EyeOutline(cfg, 0, 0, 1, p);
+    EyeCorners c = EyeCornersFor(cfg);
+    const Vector2 centers[4] = { c.TL, c.BL, c.BR, c.TR };
+    for (int i = 0; i < 8; i++) {
+        Vector2 a = p[i], b = p[(i + 1) % 8], n = p[(i + 2) % 8];
+        if ((b.x - a.x) * (n.y - b.y) - (b.y - a.y) * (n.x - b.x) > 1e-4f) return false;
+        for (const Vector2 &q : centers) {
+            if ((b.x - a.x) * (q.y - a.y) - (b.y - a.y) * (q.x - a.x) > 1e-4f) return false;
+        }
+    }
+    return true;
+}
+
+static float Random(float lo, float hi) { return lo + (hi - lo) * (rand() / (float)RAND_MAX); }
+
+int main() {
+    // Presets plus random configs in the ranges the main.cpp sliders allow. Extreme
+    // slider combinations fold the outline over itself (corners crossing), where the
+    // drawn triangles overlap and "inside" has no single answer; those are skipped.
+    std::vector<EyeConfig> configs = { Preset_Neutral, Preset_Awe, Preset_Happy };
+    srand(7);
+    while (configs.size() < 200) {
+        EyeConfig cfg = Preset_Neutral;
+        cfg.OffsetX = Random(-20, 20);      cfg.OffsetY = Random(-20, 20);
+        cfg.Height = Random(10, 100);       cfg.Width = Random(10, 100);
+        cfg.Slope_Top = Random(-1, 1);      cfg.Slope_Bottom = Random(-1, 1);
+        cfg.Radius_Top = Random(0, 50);     cfg.Radius_Bottom = Random(0, 50);
+        if (WellFormedOutline(cfg)) configs.push_back(cfg);
+    }
+
+    // Outline at the finest table: its vertices lie on the true curve, its chords sag
+    // at most r * (1 - cos(pi / 256)) inside it, plus float rounding at the boundary
+    const float center = 100.0f;
+    const float onCurveTolerance = 1e-3f;
+    const float boundaryBand = 50.0f * (1.0f - cosf(3.14159265f / (4 * ARC_TABLE_MAX_SEGMENTS))) + 1e-3f;
+    Vector2 outline[4 * (ARC_TABLE_MAX_SEGMENTS + 1)];
+
+    float maxOnCurve = 0.0f;
+    long mismatches = 0, samples = 0;
+    float maxSimdDiff = 0.0f;
+    std::vector<float> reference(256), row(256);
+
+    for (const EyeConfig &cfg : configs) {
+        EyeSdf sdf = EyeSdfBuild(cfg, center, center);
+        int count = EyeOutline(cfg, center, center, ARC_TABLE_MAX_SEGMENTS, outline);
+
+        for (int i = 0; i < count; i++) maxOnCurve = fmaxf(maxOnCurve, fabsf(EyeSdfEval(sdf, outline[i].x, outline[i].y)));
+
+        // Inside/outside over a grid, skipping the band where the chords and the arcs differ
+        for (int y = 0; y < 200; y++) {
+            for (int x = 0; x < 200; x++) {
+                float px = x + 0.37f, py = y + 0.61f;
+                float d = EyeSdfEval(sdf, px, py);
+                if (fabsf(d) <= boundaryBand) continue;
+                samples++;
+                if ((d < 0.0f) != InsidePolygon(outline, count, px, py)) mismatches++;
+            }
+        }
+
+        // Vector rows against the scalar evaluator
+        for (int y = 0; y < 200; y += 3) {
+            EyeSdfRow(sdf, 0.5f, y + 0.5f, 203, reference.data(), SIMD_SCALAR);
+            for (SimdLevel level : { SIMD_SSE2, SIMD_AVX2 }) {
+                if (level > DetectSimdLevel()) continue;
+                EyeSdfRow(sdf, 0.5f, y + 0.5f, 203, row.data(), level);
+                for (int i = 0; i < 203; i++) maxSimdDiff = fmaxf(maxSimdDiff, fabsf(row[i] - reference[i]));
+            }
+        }
+    }
+
+    printf("%zu configs\n", configs.size());
+    printf("max |sdf| on outline vertices: %.2e (limit %.0e)\n", maxOnCurve, onCurveTolerance);
+    printf("sign mismatches vs outline:    %ld of %ld samples\n", mismatches, samples);
+    printf("max SIMD vs scalar diff:       %.2e\n\n", maxSimdDiff);
+
+    // Throughput of a 1000-pixel row
+    const int width = 1000, rows = 2000;
+    EyeSdf sdf = EyeSdfBuild(Preset_Happy, 500.0f, 50.0f);
+    row.resize(width);
+    printf("%-8s %14s\n", "level", "Mpixels/s");
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 }) {
+        if (level > DetectSimdLevel()) continue;
+        auto start = std::chrono::steady_clock::now();
+        for (int y = 0; y < rows; y++) EyeSdfRow(sdf, 0.5f, (y % 100) + 0.5f, width, row.data(), level);
+        auto end = std::chrono::steady_clock::now();
+        double us = std::chrono::duration<double, std::micro>(end - start).count();
+        printf("%-8s %14.1f\n", SimdLevelName(level), (double)width * rows / us);
+    }
+
+    // Both fills cover the same area
+    SoftCanvas polygonCanvas(200, 200, SOFT_GRAY8), sdfCanvas(200, 200, SOFT_GRAY8);
+    const Color white = { 255, 255, 255, 255 };
+    SoftDrawEye(polygonCanvas, center, center, Preset_Happy, white);
+    SoftDrawEyeSdf(sdfCanvas, center, center, Preset_Happy, white);
+    double polygonArea = 0, sdfArea = 0;
+    for (size_t i = 0; i < sdfCanvas.pixels.size(); i++) {
+        polygonArea += polygonCanvas.pixels[i] / 255.0;
+        sdfArea += sdfCanvas.pixels[i] / 255.0;
+    }
+    printf("\nPreset_Happy area: polygon fill %.1f px, sdf fill %.1f px\n", polygonArea, sdfArea);
+
+    bool ok = maxOnCurve <= onCurveTolerance && mismatches == 0 && maxSimdDiff <= 1e-3f;
+    printf("%s\n", ok ? "OK" : "MISMATCH");
+    return ok ? 0 : 1;
+}
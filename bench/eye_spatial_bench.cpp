@@ -0,0 +1,127 @@
+// Spatial-grid culling for the fleet dashboard. The same screen-sized view over fleets
+// of growing size must cost about the same per frame, and zooming out over a million
+// faces must fall back to dots and then grid cells instead of tessellating everything.
+// Per frame: cull, then animate (emotion lookup) and tessellate the full-detail faces.
+// Every face overlapping the view must come out of the cull exactly once.
+#include "face/eye_emotion.h"
+#include "face/eye_spatial.h"
+#include <chrono>
+#include <stdio.h>
+
+typedef std::chrono::steady_clock Clock;
+
+static const float ScreenWidth = 1920.0f, ScreenHeight = 1080.0f;
+
+// Brute force: does the cell of face i overlap the view?
+static bool Overlaps(const EyeFleetLayout &layout, int i, Rectangle view) {
+    Vector2 p = layout.FaceCenter(i);
+    float hx = layout.cellWidth * 0.5f, hy = layout.cellHeight * 0.5f;
+    return p.x > view.x - hx && p.x < view.x + view.width + hx && p.y > view.y - hy && p.y < view.y + view.height + hy;
+}
+
+static bool CheckCull(const EyeSpatialGrid &grid, const EyeFleetLayout &layout, int count, Rectangle view, const EyeFleetView &out) {
+    std::vector<unsigned char> seen(count, 0);
+    for (int id : out.full) seen[id]++;
+    for (int id : out.dots) seen[id]++;
+    for (int c : out.cells) {
+        for (int k = 0; k < grid.CellCount(c); k++) seen[grid.CellItems(c)[k]] = 1;
+    }
+    for (int i = 0; i < count; i++) {
+        // Whole cells may carry faces just outside the view, never miss one inside it
+        bool inside = Overlaps(layout, i, view);
+        if (out.cells.empty() ? seen[i] != (inside ? 1 : 0) : (inside && !seen[i])) return false;
+    }
+    return true;
+}
+
+struct Frame {
+    EyeFleetView view;
+    std::vector<float> valence, arousal;
+    std::vector<EyeConfig> cfgs;
+    EyeFleetMesh mesh;
+    EyeFleetScratch scratch;
+};
+
+// One dashboard frame at `zoom`, centred on the fleet; returns ms
+static double RunFrame(const EmotionGrid &emotions, const EyeSpatialGrid &grid, const EyeFleetLayout &world, float maxRadius,
+                       float zoom, float time, Frame &frame, Rectangle &view) {
+    float centreX = world.x + world.columns * world.cellWidth * 0.5f, centreY = ScreenHeight * 0.5f;
+    view = Rectangle{ centreX - ScreenWidth * 0.5f / zoom, centreY - ScreenHeight * 0.5f / zoom, ScreenWidth / zoom, ScreenHeight / zoom };
+    auto t0 = Clock::now();
+    EyeFleetCull(grid, world, view, zoom, frame.view);
+
+    int n = (int)frame.view.full.size();
+    frame.valence.resize(n);
+    frame.arousal.resize(n);
+    frame.cfgs.resize(n);
+    for (int k = 0; k < n; k++) {
+        float phase = frame.view.full[k] * 2.3999632f;
+        frame.valence[k] = sinf(time * 0.3f + phase);
+        frame.arousal[k] = cosf(time * 0.47f + phase * 1.7f);
+    }
+    emotions.LookupBatch(frame.valence.data(), frame.arousal.data(), frame.cfgs.data(), n);
+    EyeFleetLayout screen = EyeFleetTransformed(world, -view.x * zoom, -view.y * zoom, zoom);
+    EyeFleetPrepare(n, maxRadius, screen, frame.mesh);
+    EyeFleetBuildList(frame.cfgs.data(), frame.view.full.data(), screen, frame.mesh, 0, n, frame.scratch);
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+int main() {
+    const int frames = 20;
+    EmotionGrid emotions;
+    float maxRadius = 0.0f;
+    for (const EmotionAnchor &a : Emotion_DefaultAnchors) maxRadius = fmaxf(maxRadius, fmaxf(a.cfg.Radius_Top, a.cfg.Radius_Bottom));
+    bool ok = true;
+
+    // Same view, growing fleet: about 40 faces across the screen
+    printf("%-9s %8s %8s %7s %7s %7s %10s %11s\n", "faces", "grid ms", "zoom", "full", "dots", "cells", "ms/frame", "all faces ms");
+    for (int count : { 10000, 100000, 1000000 }) {
+        EyeFleetLayout world = EyeFleetGrid(count, ScreenWidth, ScreenHeight);
+        EyeSpatialGrid grid;
+        auto g0 = Clock::now();
+        EyeFleetSpatialGrid(world, count, 8, grid);
+        double gridMs = std::chrono::duration<double, std::milli>(Clock::now() - g0).count();
+
+        float zoom = ScreenWidth / (40.0f * world.cellWidth);
+        Frame frame;
+        Rectangle view;
+        double ms = 0.0;
+        for (int f = 0; f < frames; f++) ms += RunFrame(emotions, grid, world, maxRadius, zoom, f / 60.0f, frame, view);
+        ok &= CheckCull(grid, world, count, view, frame.view);
+
+        // What the dashboard did before: every face, every frame
+        Frame everything;
+        auto a0 = Clock::now();
+        everything.valence.assign(count, 0.3f);
+        everything.arousal.assign(count, 0.6f);
+        everything.cfgs.resize(count);
+        emotions.LookupBatch(everything.valence.data(), everything.arousal.data(), everything.cfgs.data(), count);
+        EyeFleetPrepare(count, maxRadius, world, everything.mesh);
+        EyeFleetBuildList(everything.cfgs.data(), nullptr, world, everything.mesh, 0, count, everything.scratch);
+        double allMs = std::chrono::duration<double, std::milli>(Clock::now() - a0).count();
+
+        printf("%-9d %8.2f %8.1f %7zu %7zu %7zu %10.3f %11.1f\n", count, gridMs, zoom, frame.view.full.size(), frame.view.dots.size(),
+               frame.view.cells.size(), ms / frames, allMs);
+    }
+
+    // A million faces, zooming out from a few faces to the whole wall
+    const int count = 1000000;
+    EyeFleetLayout world = EyeFleetGrid(count, ScreenWidth, ScreenHeight);
+    EyeSpatialGrid grid;
+    EyeFleetSpatialGrid(world, count, 8, grid);
+    printf("\n%d faces, face cell %.2f px at zoom 1\n", count, world.cellWidth);
+    printf("%-8s %8s %7s %8s %7s %10s\n", "zoom", "face px", "full", "dots", "cells", "ms/frame");
+    for (float zoom : { 400.0f, 100.0f, 25.0f, 8.0f, 2.0f, 1.0f, 0.25f }) {
+        Frame frame;
+        Rectangle view;
+        double ms = 0.0;
+        for (int f = 0; f < frames; f++) ms += RunFrame(emotions, grid, world, maxRadius, zoom, f / 60.0f, frame, view);
+        bool same = CheckCull(grid, world, count, view, frame.view);
+        ok &= same;
+        printf("%-8g %8.2f %7zu %8zu %7zu %10.3f%s\n", zoom, frame.view.facePixels, frame.view.full.size(), frame.view.dots.size(),
+               frame.view.cells.size(), ms / frames, same ? "" : "  CULL MISMATCH");
+    }
+
+    printf("\n%s\n", ok ? "OK" : "MISMATCH");
+    return ok ? 0 : 1;
+}
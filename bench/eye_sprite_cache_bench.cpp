@@ -0,0 +1,161 @@
+// EyeSpriteCache on a fleet wall drawn by the software renderer. Most robots show one
+// of a few expressions, so after the first frame nearly every eye is a blit of a sprite
+// rendered once. Compares per-eye SoftDrawEye against the cache, checks every cached
+// frame against SoftDrawEye of the quantized shapes (within 8-bit coverage), and sweeps
+// the memory budget over a fleet with continuously varying moods to show LRU eviction.
+#include "face/eye_emotion.h"
+#include "face/eye_fleet.h"
+#include "face/eye_sprite_cache.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef std::chrono::steady_clock Clock;
+
+static const int Width = 1920, Height = 1080;
+static const Color Background = { 0, 0, 0, 255 };
+static const Color StatusColors[] = { { 102, 191, 255, 255 }, { 253, 249, 0, 255 }, { 230, 41, 55, 255 } };
+
+// Face centres snapped to whole pixels, so every face shares the same sub-pixel phase
+static Vector2 Centre(const EyeFleetLayout &layout, int i) {
+    Vector2 c = layout.FaceCenter(i);
+    return Vector2{ floorf(c.x), floorf(c.y) };
+}
+
+static double Ms(Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); }
+
+static int MaxDifference(const SoftCanvas &a, const SoftCanvas &b) {
+    int worst = 0;
+    for (size_t i = 0; i < a.pixels.size(); i++) {
+        int d = abs((int)a.pixels[i] - (int)b.pixels[i]);
+        if (d > worst) worst = d;
+    }
+    return worst;
+}
+
+int main() {
+    const int faces = 1000, frames = 60;
+    const float gazes[][2] = { { 0, 0 }, { -12, 0 }, { 12, 0 }, { 0, -8 }, { 0, 8 } };
+    const int presets = (int)(sizeof(Emotion_DefaultAnchors) / sizeof(Emotion_DefaultAnchors[0]));
+    bool ok = true;
+
+    EyeFleetLayout layout = EyeFleetGrid(faces, (float)Width, (float)Height);
+    float scale = layout.Scale();
+
+    // Each robot holds an expression and a gaze, and switches to another now and then
+    srand(5);
+    std::vector<int> expression(faces), gaze(faces);
+    for (int i = 0; i < faces; i++) {
+        expression[i] = rand() % presets;
+        gaze[i] = rand() % 5;
+    }
+    auto Pose = [&](int i) {
+        EyeConfig cfg = Emotion_DefaultAnchors[expression[i]].cfg;
+        cfg.OffsetX += gazes[gaze[i]][0];
+        cfg.OffsetY += gazes[gaze[i]][1];
+        return cfg;
+    };
+
+    SoftCanvas direct(Width, Height, SOFT_RGBA8), reference(Width, Height, SOFT_RGBA8), cached(Width, Height, SOFT_RGBA8);
+    EyeSpriteCache cache;
+    double directMs = 0.0, cachedMs = 0.0;
+    int worst = 0;
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < faces; i++) {
+            if (rand() % 50 == 0) expression[i] = rand() % presets;
+            if (rand() % 10 == 0) gaze[i] = rand() % 5;
+        }
+
+        // What the software path does today: rasterize every eye
+        auto t0 = Clock::now();
+        direct.Clear(Background);
+        for (int i = 0; i < faces; i++) {
+            Vector2 c = Centre(layout, i);
+            EyeConfig cfg = EyeFleetScaled(Pose(i), scale);
+            Color color = StatusColors[i % 17 == 0 ? 2 : (i % 5 == 0 ? 1 : 0)];
+            SoftDrawEye(direct, c.x - layout.spacing * scale, c.y, cfg, color);
+            SoftDrawEye(direct, c.x + layout.spacing * scale, c.y, EyeConfigRight(cfg), color);
+        }
+        auto t1 = Clock::now();
+        cached.Clear(Background);
+        for (int i = 0; i < faces; i++) {
+            Vector2 c = Centre(layout, i);
+            cache.DrawPair(cached, c.x, c.y, layout.spacing, Pose(i), scale, StatusColors[i % 17 == 0 ? 2 : (i % 5 == 0 ? 1 : 0)]);
+        }
+        auto t2 = Clock::now();
+        directMs += Ms(t0, t1);
+        cachedMs += Ms(t1, t2);
+
+        // Same frame, rasterized from the quantized shapes the cache keyed on
+        reference.Clear(Background);
+        for (int i = 0; i < faces; i++) {
+            Vector2 c = Centre(layout, i);
+            EyeConfig cfg = Pose(i);
+            Color color = StatusColors[i % 17 == 0 ? 2 : (i % 5 == 0 ? 1 : 0)];
+            for (int side = 0; side < 2; side++) {
+                int x, y;
+                float cx = c.x + (side ? 1.0f : -1.0f) * layout.spacing * scale;
+                EyeSpriteKey key = EyeSpriteKeyFor(side ? EyeConfigRight(cfg) : cfg, cx, c.y, scale, x, y);
+                SoftDrawEye(reference, (float)x, (float)y, EyeSpriteConfig(key), color);
+            }
+        }
+        int diff = MaxDifference(reference, cached);
+        if (diff > worst) worst = diff;
+    }
+    ok &= worst <= 2;
+
+    const EyeSpriteCacheStats &s = cache.Stats();
+    printf("%d faces (%.0f px cells), %d frames, %d presets x 5 gazes\n\n", faces, layout.cellWidth, frames, presets);
+    printf("%-22s %10s\n", "", "ms/frame");
+    printf("%-22s %10.2f\n", "SoftDrawEye per eye", directMs / frames);
+    printf("%-22s %10.2f  (%.1fx)\n", "EyeSpriteCache", cachedMs / frames, directMs / cachedMs);
+    printf("\nhit rate %.2f%%, %llu misses, %d sprites, %.1f KB\n", s.HitRate() * 100.0, (unsigned long long)s.misses, s.sprites, s.bytes / 1024.0);
+    printf("max channel difference vs quantized SoftDrawEye: %d\n\n", worst);
+
+    // Moods from the emotion plane: distinct shapes everywhere, so the budget decides
+    EmotionGrid emotions;
+    std::vector<float> valence(faces), arousal(faces);
+    std::vector<EyeConfig> moods(faces);
+    printf("%-10s %9s %9s %8s %10s %10s\n", "budget KB", "hit rate", "evictions", "sprites", "used KB", "ms/frame");
+    for (size_t budget : { (size_t)64 << 10, (size_t)256 << 10, (size_t)1 << 20, (size_t)8 << 20 }) {
+        EyeSpriteCache lru(budget);
+        double ms = 0.0;
+        bool within = true;
+        for (int f = 0; f < frames; f++) {
+            for (int i = 0; i < faces; i++) {
+                // Moods drift on a 1/16 lattice, so faces keep revisiting the same shapes
+                valence[i] = roundf(sinf(f * 0.05f + i * 2.3999632f) * 16.0f) / 16.0f;
+                arousal[i] = roundf(cosf(f * 0.08f + i * 4.08f) * 16.0f) / 16.0f;
+            }
+            emotions.LookupBatch(valence.data(), arousal.data(), moods.data(), faces);
+            auto t0 = Clock::now();
+            cached.Clear(Background);
+            for (int i = 0; i < faces; i++) {
+                Vector2 c = Centre(layout, i);
+                lru.DrawPair(cached, c.x, c.y, layout.spacing, moods[i], scale, StatusColors[0]);
+            }
+            ms += Ms(t0, Clock::now());
+            within &= lru.Stats().bytes <= budget;
+        }
+        ok &= within;
+        const EyeSpriteCacheStats &l = lru.Stats();
+        printf("%-10zu %8.2f%% %9llu %8d %10.1f %10.2f%s\n", budget >> 10, l.HitRate() * 100.0, (unsigned long long)l.evictions,
+               l.sprites, l.bytes / 1024.0, ms / frames, within ? "" : "  OVER BUDGET");
+    }
+
+    // A sprite bigger than the budget is drawn but not kept, and shrinking the budget
+    // below the newest sprite evicts that one too
+    EyeSpriteCache tiny(64);
+    int tx, ty;
+    EyeSpriteKey big = EyeSpriteKeyFor(Preset_Neutral, 100.0f, 100.0f, 4.0f, tx, ty);
+    bool drawn = tiny.Get(big).mask.width > 0;
+    EyeSpriteCache shrink;
+    shrink.Get(big);
+    shrink.SetBudget(64);
+    bool bounded = drawn && tiny.Stats().bytes <= 64 && tiny.Stats().uncached == 1 && shrink.Stats().bytes <= 64;
+    printf("\nsprite over budget: %s\n", bounded ? "drawn, not cached" : "CACHED OVER BUDGET");
+    ok &= bounded;
+
+    printf("\n%s\n", ok ? "OK" : "MISMATCH");
+    return ok ? 0 : 1;
+}
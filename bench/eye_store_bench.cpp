@@ -0,0 +1,143 @@
+// EyeConfigStore against arrays of structs: per-frame lerp of every face (EyeStoreLerp
+// over aligned columns vs EyeConfigLerpBatch over EyeConfig), colour packing for
+// ShapeConfig-style faces, and the cost of scatter/gather at each SIMD level.
+// Round trips must be exact and both lerps must agree.
+#include "face/eye_store.h"
+#include "face/eye_transition.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef std::chrono::steady_clock Clock;
+
+// Same layout as Basic_0/main_5.cpp
+struct ShapeConfig {
+    float OffsetX, OffsetY, Height, Width, Slope_Top, Slope_Bottom, Radius_Top, Radius_Bottom;
+    float R, G, B, A;
+    bool Inverse_Radius_Top, Inverse_Radius_Bottom, Inverse_Offset_Top, Inverse_Offset_Bottom;
+};
+
+static float Random(float lo, float hi) { return lo + (hi - lo) * (rand() / (float)RAND_MAX); }
+
+static EyeConfig RandomConfig() {
+    EyeConfig cfg = { Random(-10, 10), Random(-10, 10), Random(10, 60), Random(20, 60), Random(-0.4f, 0.4f),
+                      Random(-0.4f, 0.4f), Random(0, 20), Random(0, 20), rand() % 2 == 0, rand() % 3 == 0, rand() % 5 == 0, rand() % 7 == 0 };
+    return cfg;
+}
+
+static bool SameConfig(const EyeConfig &a, const EyeConfig &b, float tolerance) {
+    const float *pa = &a.OffsetX, *pb = &b.OffsetX;
+    for (int k = 0; k < 8; k++) {
+        if (fabsf(pa[k] - pb[k]) > tolerance) return false;
+    }
+    return a.Inverse_Radius_Top == b.Inverse_Radius_Top && a.Inverse_Radius_Bottom == b.Inverse_Radius_Bottom &&
+           a.Inverse_Offset_Top == b.Inverse_Offset_Top && a.Inverse_Offset_Bottom == b.Inverse_Offset_Bottom;
+}
+
+static double Ns(Clock::time_point a, Clock::time_point b, double items) {
+    return std::chrono::duration<double, std::nano>(b - a).count() / items;
+}
+
+int main() {
+    const int faces = 10003; // not a multiple of any vector width
+    const int frames = 500;
+    srand(7);
+    bool ok = true;
+
+    std::vector<EyeConfig> from(faces), to(faces), aos(faces), back(faces);
+    std::vector<ShapeConfig> shapes(faces), shapesBack(faces);
+    for (int i = 0; i < faces; i++) {
+        from[i] = RandomConfig();
+        to[i] = RandomConfig();
+        const EyeConfig &c = from[i];
+        shapes[i] = ShapeConfig{ c.OffsetX, c.OffsetY, c.Height, c.Width, c.Slope_Top, c.Slope_Bottom, c.Radius_Top, c.Radius_Bottom,
+                                 (float)(rand() % 256), (float)(rand() % 256), (float)(rand() % 256), 255.0f,
+                                 c.Inverse_Radius_Top, c.Inverse_Radius_Bottom, c.Inverse_Offset_Top, c.Inverse_Offset_Bottom };
+    }
+
+    printf("%d faces, %d-byte EyeConfig, %d-byte ShapeConfig, store %.1f bytes/face, best level: %s\n\n", faces,
+           (int)sizeof(EyeConfig), (int)sizeof(ShapeConfig), EYE_FIELD_COUNT * 4 + 4 + EYE_FLAG_COUNT / 8.0, SimdLevelName(DetectSimdLevel()));
+
+    // Scatter / gather round trips, every level
+    EyeConfigStore store, storeTo, storeOut;
+    store.Resize(faces);
+    printf("%-8s %14s %14s\n", "level", "scatter ns/face", "gather ns/face");
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 }) {
+        if (level > DetectSimdLevel()) continue;
+        auto t0 = Clock::now();
+        for (int f = 0; f < 20; f++) store.Scatter(from.data(), 0, faces, level);
+        auto t1 = Clock::now();
+        for (int f = 0; f < 20; f++) store.Gather(back.data(), 0, faces, level);
+        auto t2 = Clock::now();
+        for (int i = 0; i < faces; i++) ok &= SameConfig(from[i], back[i], 0.0f);
+        printf("%-8s %14.2f %14.2f\n", SimdLevelName(level), Ns(t0, t1, 20.0 * faces), Ns(t1, t2, 20.0 * faces));
+    }
+
+    // Partial, unaligned ranges and single faces
+    EyeConfigStore partial;
+    partial.Resize(faces);
+    partial.Scatter(from.data(), 0, 37);
+    partial.Scatter(from.data() + 37, 37, faces - 37);
+    for (int i = 0; i < faces; i++) ok &= SameConfig(partial.Get(i), from[i], 0.0f);
+    partial.Set(100, to[100]);
+    ok &= SameConfig(partial.Get(100), to[100], 0.0f) && SameConfig(partial.Get(99), from[99], 0.0f) && SameConfig(partial.Get(101), from[101], 0.0f);
+    printf("round trips exact: %s\n", ok ? "yes" : "NO");
+
+    // Shapes: colours packed once on the way in
+    store.ScatterShapes(shapes.data(), 0, faces);
+    store.GatherShapes(shapesBack.data(), 0, faces);
+    bool shapesOk = memcmp(shapes.data(), shapesBack.data(), sizeof(ShapeConfig) * faces) == 0;
+    for (int i = 0; i < faces; i++) shapesOk &= store.Colors()[i].r == (unsigned char)shapes[i].R;
+    ok &= shapesOk;
+    printf("shape round trip exact: %s\n\n", shapesOk ? "yes" : "NO");
+
+    // Per-frame lerp of every face
+    std::vector<float> tAos(faces);
+    EyeAlignedVector<float> t(store.Stride(), 0.0f);
+    store.Scatter(from.data(), 0, faces);
+    storeTo.Resize(faces);
+    storeTo.Scatter(to.data(), 0, faces);
+    storeOut.Resize(faces);
+
+    for (int i = 0; i < faces; i++) t[i] = tAos[i] = (i % 64) / 63.0f;
+
+    float sink = 0.0f;
+    auto a0 = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        EyeConfigLerpBatch(from.data(), to.data(), tAos.data(), aos.data(), faces);
+        sink += aos[f].Height;
+    }
+    auto a1 = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        EyeStoreLerp(store, storeTo, t.data(), storeOut);
+        sink += storeOut.Field(EYE_FIELD_HEIGHT)[f];
+    }
+    auto a2 = Clock::now();
+    // Columns not in the mask aren't touched at all; an array of structs has no such option
+    for (int f = 0; f < frames; f++) {
+        EyeStoreLerp(store, storeTo, t.data(), storeOut, EYE_FIELDS_GAZE);
+        sink += storeOut.Field(EYE_FIELD_OFFSET_X)[f];
+    }
+    auto a3 = Clock::now();
+    EyeStoreLerp(store, storeTo, t.data(), storeOut);
+    storeOut.Gather(back.data(), 0, faces);
+    for (int i = 0; i < faces; i++) ok &= SameConfig(aos[i], back[i], 1e-4f);
+
+    double aosNs = Ns(a0, a1, (double)faces * frames), soaNs = Ns(a1, a2, (double)faces * frames);
+    printf("%-22s %10s\n", "lerp, every face", "ns/face");
+    printf("%-22s %10.2f\n", "EyeConfig array", aosNs);
+    printf("%-22s %10.2f  (%.1fx)\n", "EyeConfigStore", soaNs, aosNs / soaNs);
+    printf("%-22s %10.2f\n", "EyeConfigStore, gaze", Ns(a2, a3, (double)faces * frames));
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 }) {
+        if (level > DetectSimdLevel()) continue;
+        EyeStoreLerp(store, storeTo, t.data(), storeOut, EYE_FIELDS_ALL, level);
+        storeOut.Gather(back.data(), 0, faces);
+        bool same = true;
+        for (int i = 0; i < faces; i++) same &= SameConfig(aos[i], back[i], 1e-4f);
+        ok &= same;
+        if (!same) printf("lerp mismatch at %s\n", SimdLevelName(level));
+    }
+
+    printf("\n%s (checksum %.1f)\n", ok ? "OK" : "MISMATCH", sink);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,51 @@
+// Batched expression transitions: EyeConfigLerpBatch scalar vs SSE2 vs AVX2 over a wall
+// of eyes, plus the full EyeTransitionBatch::Evaluate (easing + blend) per frame.
+#include "face/eye_transition.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+int main() {
+    const int eyes = 10000;
+    const int frames = 500;
+    const EyeConfig presets[3] = { Preset_Neutral, Preset_Happy, Preset_Awe };
+
+    std::vector<EyeConfig> from(eyes), to(eyes), reference(eyes), out(eyes);
+    std::vector<float> t(eyes);
+    for (int i = 0; i < eyes; i++) {
+        from[i] = presets[i % 3];
+        to[i] = presets[(i + 1) % 3];
+        t[i] = (i % 101) / 100.0f;
+    }
+
+    EyeConfigLerpBatch(from.data(), to.data(), t.data(), reference.data(), eyes, SIMD_SCALAR);
+    printf("%d eyes, best level: %s\n\n", eyes, SimdLevelName(DetectSimdLevel()));
+    printf("%-8s %12s %14s %12s\n", "level", "us/batch", "Meyes/s", "max diff");
+
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 }) {
+        if (level > DetectSimdLevel()) continue;
+
+        EyeConfigLerpBatch(from.data(), to.data(), t.data(), out.data(), eyes, level);
+        float diff = 0.0f;
+        for (int i = 0; i < eyes; i++) {
+            const float *a = &out[i].OffsetX, *b = &reference[i].OffsetX;
+            for (int k = 0; k < 8; k++) diff = fmaxf(diff, fabsf(a[k] - b[k]));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++) EyeConfigLerpBatch(from.data(), to.data(), t.data(), out.data(), eyes, level);
+        auto end = std::chrono::steady_clock::now();
+        double us = std::chrono::duration<double, std::micro>(end - start).count() / frames;
+        printf("%-8s %12.1f %14.1f %12.2e\n", SimdLevelName(level), us, eyes / us, diff);
+    }
+
+    // Staggered transitions with mixed easing, evaluated at 60 fps
+    EyeTransitionBatch batch;
+    batch.Resize(eyes, Preset_Neutral);
+    for (int i = 0; i < eyes; i++) batch.Start(i, from[i], to[i], (i % 60) / 60.0f, 0.3f, (EaseType)(i % EASE_COUNT));
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) batch.Evaluate(f / 60.0f, out.data());
+    auto end = std::chrono::steady_clock::now();
+    printf("\nEyeTransitionBatch::Evaluate: %.1f us/frame\n", std::chrono::duration<double, std::micro>(end - start).count() / frames);
+    return 0;
+}
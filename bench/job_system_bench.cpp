@@ -0,0 +1,104 @@
+// JobSystem on the fleet dashboard's per-frame work: every face's emotion lookup and
+// triangle generation, chunked into jobs and joined before submission. Reports frame
+// time and speedup per thread count against the single-threaded path, checks the mesh
+// is byte-identical to EyeFleetBuild, and stress-tests that every index of random
+// (and nested) dispatches runs exactly once.
+#include "face/eye_emotion.h"
+#include "face/eye_fleet.h"
+#include "face/job_system.h"
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef std::chrono::steady_clock Clock;
+
+static bool StressTest(JobSystem &jobs) {
+    std::vector<std::atomic<int>> hits(5000);
+    srand(11);
+    for (int round = 0; round < 300; round++) {
+        int count = 1 + rand() % 5000, grain = 1 + rand() % 64;
+        for (int i = 0; i < count; i++) hits[i].store(0);
+        jobs.ParallelFor(count, grain, [&](int begin, int end) {
+            for (int i = begin; i < end; i++) hits[i].fetch_add(1, std::memory_order_relaxed);
+        });
+        for (int i = 0; i < count; i++) {
+            if (hits[i].load() != 1) return false;
+        }
+    }
+
+    // Jobs that dispatch and wait on groups of their own
+    std::atomic<int> total{ 0 };
+    jobs.ParallelFor(16, 1, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            jobs.ParallelFor(1000, 7, [&](int b, int e) { total.fetch_add(e - b, std::memory_order_relaxed); });
+        }
+    });
+    return total.load() == 16 * 1000;
+}
+
+int main() {
+    const int faces = 10000, frames = 60, grain = 256;
+    const int threadCounts[] = { 1, 2, 4, 8, 16 };
+    bool ok = true;
+
+    EmotionGrid emotions;
+    float maxRadius = 0.0f;
+    for (const EmotionAnchor &a : Emotion_DefaultAnchors) maxRadius = fmaxf(maxRadius, fmaxf(a.cfg.Radius_Top, a.cfg.Radius_Bottom));
+    EyeFleetLayout layout = EyeFleetGrid(faces, 1920.0f, 1080.0f);
+    std::vector<float> phase(faces), valence(faces), arousal(faces);
+    for (int i = 0; i < faces; i++) phase[i] = i * 2.3999632f;
+    std::vector<EyeConfig> cfgs(faces);
+
+    // One frame of dashboard work for faces [begin, end)
+    auto animate = [&](int begin, int end, float time) {
+        for (int i = begin; i < end; i++) {
+            valence[i] = sinf(time * 0.3f + phase[i]);
+            arousal[i] = cosf(time * 0.47f + phase[i] * 1.7f);
+        }
+        emotions.LookupBatch(&valence[begin], &arousal[begin], &cfgs[begin], end - begin);
+    };
+
+    // Reference: everything on one thread
+    EyeFleetMesh reference;
+    EyeFleetScratch scratch;
+    double serialMs = 0.0;
+    for (int f = 0; f < frames; f++) {
+        auto t0 = Clock::now();
+        animate(0, faces, f / 60.0f);
+        EyeFleetPrepare(faces, maxRadius, layout, reference);
+        EyeFleetBuildRange(cfgs.data(), layout, reference, 0, faces, scratch);
+        serialMs += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    }
+    serialMs /= frames;
+
+    printf("%d faces, %d-face chunks, %u hardware threads\n\n", faces, grain, std::thread::hardware_concurrency());
+    printf("%-8s %10s %9s %8s\n", "threads", "ms/frame", "speedup", "stress");
+    printf("%-8s %10.3f %9s %8s\n", "serial", serialMs, "1.00x", "-");
+    for (int threads : threadCounts) {
+        JobSystem jobs(threads);
+        std::vector<EyeFleetScratch> scratches(jobs.Threads());
+        EyeFleetMesh mesh;
+        double ms = 0.0;
+        for (int f = 0; f < frames; f++) {
+            auto t0 = Clock::now();
+            float time = f / 60.0f;
+            EyeFleetPrepare(faces, maxRadius, layout, mesh);
+            jobs.ParallelFor(faces, grain, [&](int begin, int end) {
+                animate(begin, end, time);
+                EyeFleetBuildRange(cfgs.data(), layout, mesh, begin, end, scratches[jobs.ThreadIndex()]);
+            });
+            ms += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        }
+        ms /= frames;
+
+        bool same = mesh.vertices.size() == reference.vertices.size() &&
+                    memcmp(mesh.vertices.data(), reference.vertices.data(), mesh.vertices.size() * sizeof(Vector2)) == 0;
+        bool stress = StressTest(jobs);
+        ok &= same && stress;
+        printf("%-8d %10.3f %8.2fx %8s%s\n", threads, ms, serialMs / ms, stress ? "ok" : "FAIL", same ? "" : "  MESH MISMATCH");
+    }
+    printf("\n%s\n", ok ? "OK" : "MISMATCH");
+    return ok ? 0 : 1;
+}
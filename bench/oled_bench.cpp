@@ -0,0 +1,59 @@
+// 1-bpp SSD1306 frame encoding of a rendered 128x64 face: scalar vs SSE2 vs AVX2.
+// Pass a path to also write the encoded frame as a PBM image.
+#include "face/oled.h"
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+    const int frames = 200000;
+
+    // main.cpp face scaled to the panel: eyes 64 px apart
+    SoftCanvas canvas(OLED_WIDTH, OLED_HEIGHT, SOFT_GRAY8);
+    const Color white = { 255, 255, 255, 255 };
+    SoftDrawEye(canvas, OLED_WIDTH / 2 - 32, OLED_HEIGHT / 2, Preset_Happy, white);
+    SoftDrawEye(canvas, OLED_WIDTH / 2 + 32, OLED_HEIGHT / 2, Preset_Happy, white);
+
+    OledFrame reference;
+    OledEncodeCanvas(canvas, 127, reference, SIMD_SCALAR);
+    int lit = 0;
+    for (int y = 0; y < OLED_HEIGHT; y++) {
+        for (int x = 0; x < OLED_WIDTH; x++) lit += reference.Pixel(x, y);
+    }
+    printf("%dx%d face, %d lit pixels, %d bytes/frame, best level: %s\n\n",
+           OLED_WIDTH, OLED_HEIGHT, lit, OLED_FRAME_BYTES, SimdLevelName(DetectSimdLevel()));
+    printf("%-8s %12s %14s %8s\n", "level", "ns/frame", "frames/s", "match");
+
+    for (SimdLevel level : { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2 }) {
+        if (level > DetectSimdLevel()) continue;
+
+        OledFrame frame;
+        OledEncodeCanvas(canvas, 127, frame, level);
+        bool match = memcmp(frame.bytes, reference.bytes, OLED_FRAME_BYTES) == 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++) {
+            OledEncode(canvas.pixels.data(), canvas.Stride(), (uint8_t)(127 + (f & 1)), frame, level);
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / frames;
+        printf("%-8s %12.1f %14.0f %8s\n", SimdLevelName(level), ns, 1e9 / ns, match ? "yes" : "NO");
+        if (!match) return 1;
+    }
+
+    if (argc > 1) {
+        FILE *f = fopen(argv[1], "w");
+        if (!f) {
+            fprintf(stderr, "cannot write %s\n", argv[1]);
+            return 1;
+        }
+        fprintf(f, "P1\n%d %d\n", OLED_WIDTH, OLED_HEIGHT);
+        for (int y = 0; y < OLED_HEIGHT; y++) {
+            for (int x = 0; x < OLED_WIDTH; x++) fputc(reference.Pixel(x, y) ? '1' : '0', f);
+            fputc('\n', f);
+        }
+        fclose(f);
+        printf("\nwrote %s\n", argv[1]);
+    }
+    return 0;
+}
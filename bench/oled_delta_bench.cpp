@@ -0,0 +1,105 @@
+// Delta + PackBits streaming of OLED frames over a scripted face sequence: preset
+// transitions, blinks and gaze shifts at 60 fps. Reports compression against raw
+// 1024-byte frames and encode / decode time; every frame is decoded and checked.
+#include "face/oled_delta.h"
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+static EyeConfig Lerp(const EyeConfig &a, const EyeConfig &b, float t) {
+    t = t * t * (3 - 2 * t); // smoothstep
+    EyeConfig c = a;
+    c.OffsetX = a.OffsetX + (b.OffsetX - a.OffsetX) * t;
+    c.OffsetY = a.OffsetY + (b.OffsetY - a.OffsetY) * t;
+    c.Height = a.Height + (b.Height - a.Height) * t;
+    c.Width = a.Width + (b.Width - a.Width) * t;
+    c.Slope_Top = a.Slope_Top + (b.Slope_Top - a.Slope_Top) * t;
+    c.Slope_Bottom = a.Slope_Bottom + (b.Slope_Bottom - a.Slope_Bottom) * t;
+    c.Radius_Top = a.Radius_Top + (b.Radius_Top - a.Radius_Top) * t;
+    c.Radius_Bottom = a.Radius_Bottom + (b.Radius_Bottom - a.Radius_Bottom) * t;
+    return c;
+}
+
+// Appends a move from the last config to `to` over `frames`, then holds it for `hold`
+static void Script(std::vector<EyeConfig> &seq, const EyeConfig &to, int frames, int hold) {
+    EyeConfig from = seq.back();
+    for (int i = 1; i <= frames; i++) seq.push_back(Lerp(from, to, (float)i / frames));
+    for (int i = 0; i < hold; i++) seq.push_back(to);
+}
+
+static void Blink(std::vector<EyeConfig> &seq) {
+    EyeConfig open = seq.back(), closed = open;
+    closed.Height = 2;
+    closed.Radius_Top = closed.Radius_Bottom = 1;
+    Script(seq, closed, 4, 1);
+    Script(seq, open, 5, 20);
+}
+
+int main() {
+    std::vector<EyeConfig> seq = { Preset_Neutral };
+    Script(seq, Preset_Neutral, 0, 30);
+    Blink(seq);
+    Script(seq, Preset_Happy, 15, 40);
+    EyeConfig glance = Preset_Happy;
+    glance.OffsetX = 12;
+    Script(seq, glance, 8, 30);
+    Blink(seq);
+    Script(seq, Preset_Happy, 8, 20);
+    Script(seq, Preset_Awe, 15, 40);
+    Blink(seq);
+    Script(seq, Preset_Neutral, 15, 30);
+
+    // Render and encode every frame up front
+    const Color white = { 255, 255, 255, 255 };
+    SoftCanvas canvas(OLED_WIDTH, OLED_HEIGHT, SOFT_GRAY8);
+    std::vector<OledFrame> frames(seq.size());
+    for (size_t i = 0; i < seq.size(); i++) {
+        canvas.Clear(Color{ 0, 0, 0, 255 });
+        SoftDrawEye(canvas, OLED_WIDTH / 2 - 32, OLED_HEIGHT / 2, seq[i], white);
+        SoftDrawEye(canvas, OLED_WIDTH / 2 + 32, OLED_HEIGHT / 2, seq[i], white);
+        OledEncodeCanvas(canvas, 127, frames[i]);
+    }
+
+    const int repeats = 200;
+    std::vector<uint8_t> stream(seq.size() * OLED_DELTA_MAX_BYTES);
+    std::vector<int> sizes(seq.size());
+    size_t total = 0;
+    int keyframes = 0, unchanged = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        total = 0;
+        for (size_t i = 0; i < frames.size(); i++) {
+            sizes[i] = OledDeltaEncode(i ? &frames[i - 1] : nullptr, frames[i], &stream[total]);
+            total += sizes[i];
+        }
+    }
+    auto mid = std::chrono::steady_clock::now();
+
+    OledFrame display;
+    bool ok = true;
+    for (int r = 0; r < repeats && ok; r++) {
+        size_t pos = 0;
+        for (size_t i = 0; i < frames.size() && ok; i++) {
+            ok = OledDeltaDecode(&stream[pos], sizes[i], display) && memcmp(display.bytes, frames[i].bytes, OLED_FRAME_BYTES) == 0;
+            pos += sizes[i];
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        keyframes += i == 0 || sizes[i] > OLED_FRAME_BYTES / 2;
+        unchanged += sizes[i] == 3;
+    }
+    double encodeUs = std::chrono::duration<double, std::micro>(mid - start).count() / (repeats * frames.size());
+    double decodeUs = std::chrono::duration<double, std::micro>(end - mid).count() / (repeats * frames.size());
+    size_t raw = frames.size() * OLED_FRAME_BYTES;
+
+    printf("%zu frames (%.1f s at 60 fps), %d unchanged, %d full-size\n", frames.size(), frames.size() / 60.0, unchanged, keyframes);
+    printf("raw:      %8zu bytes  %8.1f KB/s\n", raw, raw * 60.0 / frames.size() / 1024);
+    printf("delta:    %8zu bytes  %8.1f KB/s  ratio %.1fx\n", total, total * 60.0 / frames.size() / 1024, (double)raw / total);
+    printf("encode:   %8.2f us/frame\n", encodeUs);
+    printf("decode:   %8.2f us/frame\n", decodeUs);
+    printf("%s\n", ok ? "OK" : "DECODE MISMATCH");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+// Fixed-step simulation vs per-frame updates. The idle scheduler for a crowd of faces
+// is run for 20 simulated seconds at several render rates, including a jittery one.
+// Stepped by SimClock at 200 Hz every render rate reaches bit-identical poses; updated
+// once per rendered frame (the old main loops) the result depends on the frame rate.
+// Last, the same simulation runs headless, as fast as the CPU allows.
+#include "face/eye_idle.h"
+#include "face/sim_clock.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static float MaxDiff(const std::vector<EyeConfig> &a, const std::vector<EyeConfig> &b) {
+    float diff = 0.0f;
+    for (size_t i = 0; i < a.size(); i++) {
+        for (int k = 0; k < 8; k++) diff = fmaxf(diff, fabsf((&a[i].OffsetX)[k] - (&b[i].OffsetX)[k]));
+    }
+    return diff;
+}
+
+int main() {
+    const int faces = 200;
+    const float seconds = 20.0f;
+    const float hz = 200.0f;
+    const uint64_t target = (uint64_t)(seconds * hz);
+    const float rates[] = { 30.0f, 60.0f, 144.0f, 0.0f }; // 0: jittery 5-40 ms frames
+    bool ok = true;
+
+    std::vector<EyeConfig> fixedRef, frameRef;
+    printf("%-10s %10s %16s %16s\n", "render", "frames", "fixed max diff", "per-frame diff");
+    for (float rate : rates) {
+        // Fixed step
+        EyeIdleScheduler idle;
+        idle.Resize(faces, Preset_Neutral);
+        SimClock clock(hz, 1000);
+        EyeSimFrames sim;
+        sim.Resize(faces, Preset_Neutral);
+        std::vector<EyeConfig> state(faces), render(faces), snapshot;
+        uint32_t rng = 12345;
+        int frames = 0;
+        while (clock.Steps() < target) {
+            float dt = 1.0f / rate;
+            if (rate == 0.0f) {
+                rng = rng * 1664525u + 1013904223u;
+                dt = 0.005f + (rng >> 8) % 35000 / 1e6f;
+            }
+            clock.Advance(dt, [&](float h) {
+                idle.Update(h);
+                for (int i = 0; i < faces; i++) state[i] = idle.Pose(i);
+                sim.Push(state.data());
+                if (clock.Steps() + 1 == target) snapshot = state;
+            });
+            sim.Interpolate(clock.Alpha(), render.data());
+            frames++;
+        }
+
+        // Once per rendered frame, as main_0 did
+        EyeIdleScheduler perFrame;
+        perFrame.Resize(faces, Preset_Neutral);
+        std::vector<EyeConfig> framePose(faces);
+        rng = 12345;
+        for (float t = 0.0f; t < seconds;) {
+            float dt = 1.0f / rate;
+            if (rate == 0.0f) {
+                rng = rng * 1664525u + 1013904223u;
+                dt = 0.005f + (rng >> 8) % 35000 / 1e6f;
+            }
+            perFrame.Update(dt);
+            t += dt;
+        }
+        for (int i = 0; i < faces; i++) framePose[i] = perFrame.Pose(i);
+
+        if (fixedRef.empty()) {
+            fixedRef = snapshot;
+            frameRef = framePose;
+        }
+        float fixedDiff = MaxDiff(snapshot, fixedRef), frameDiff = MaxDiff(framePose, frameRef);
+        if (snapshot.size() != fixedRef.size() || memcmp(snapshot.data(), fixedRef.data(), snapshot.size() * sizeof(EyeConfig)) != 0) ok = false;
+        char name[16];
+        if (rate > 0.0f) snprintf(name, sizeof(name), "%.0f fps", rate);
+        else snprintf(name, sizeof(name), "jitter");
+        printf("%-10s %10d %16.2e %16.2e\n", name, frames, fixedDiff, frameDiff);
+    }
+
+    // Headless: one Advance covers a whole minute
+    const int crowd = 1000;
+    EyeIdleScheduler idle;
+    idle.Resize(crowd, Preset_Neutral);
+    SimClock clock(hz, 1 << 30);
+    auto start = std::chrono::steady_clock::now();
+    clock.Advance(60.0f, [&](float h) { idle.Update(h); });
+    auto end = std::chrono::steady_clock::now();
+    double wall = std::chrono::duration<double>(end - start).count();
+    printf("\nheadless: %d faces, %.0f s simulated (%llu steps) in %.3f s wall, %.0fx real time\n",
+           crowd, clock.Time(), (unsigned long long)clock.Steps(), wall, clock.Time() / wall);
+
+    if (!ok) {
+        printf("\nFixed-step result depends on the render rate\n");
+        return 1;
+    }
+    return 0;
+}
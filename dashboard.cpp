@@ -0,0 +1,302 @@
+#include "raylib.h"
+#include "rlgl.h"
+#include "face/eye_emotion.h"
+#include "face/eye_fleet.h"
+#include "face/eye_spatial.h"
+#include "face/job_system.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// Fleet dashboard: every robot's current face in one grid. Faces are built into one
+// triangle list per frame and submitted through rlgl's batch, which only flushes when
+// its vertex buffer fills up. Worker threads animate and build frame N+1 while the main
+// thread submits frame N. A spatial grid culls the wall to the camera's view; faces too
+// small to read are drawn as status dots, so big walls cost what's on screen.
+//   dashboard [faces]   interactive; UP / DOWN double or halve the fleet, drag to pan,
+//                       wheel to zoom, R to see the whole wall
+//   dashboard --bench   sweeps the face count and zoom and prints FPS for each
+
+// --- Fleet state ---
+// Stand-in for live telemetry: each robot's mood drifts around the emotion plane
+enum FleetStatus { FLEET_OK, FLEET_BUSY, FLEET_TROUBLE };
+static const Color StatusColors[] = { SKYBLUE, YELLOW, RED };
+
+struct Fleet {
+    std::vector<float> phase;
+    std::vector<unsigned char> status;     // FleetStatus per face
+    std::vector<unsigned char> cellStatus; // worst status per grid cell
+    EyeFleetLayout layout;                 // world units: the whole wall at zoom 1
+    EyeSpatialGrid grid;
+
+    int Count() const { return (int)phase.size(); }
+
+    void Resize(int n, float width, float height) {
+        phase.resize(n);
+        status.resize(n);
+        for (int i = 0; i < n; i++) {
+            phase[i] = i * 2.3999632f; // golden angle, so neighbours don't move in step
+            // Mostly healthy, some busy, a few in trouble
+            status[i] = i % 17 == 0 ? FLEET_TROUBLE : (i % 5 == 0 ? FLEET_BUSY : FLEET_OK);
+        }
+
+        layout = EyeFleetGrid(n, width, height);
+        EyeFleetSpatialGrid(layout, n, 8, grid);
+        // A cell dot stands for many faces: show the one that needs attention
+        cellStatus.assign(grid.Cells(), FLEET_OK);
+        for (int c = 0; c < grid.Cells(); c++) {
+            for (int k = 0; k < grid.CellCount(c); k++) {
+                if (status[grid.CellItems(c)[k]] > cellStatus[c]) cellStatus[c] = status[grid.CellItems(c)[k]];
+            }
+        }
+    }
+
+    // Faces ids[begin, end) into out[begin, end), so ranges can update in parallel
+    void Update(const EmotionGrid &emotions, float time, const int *ids, int begin, int end, EyeConfig *out) const {
+        float valence[EYE_FLEET_CHUNK], arousal[EYE_FLEET_CHUNK];
+        for (int first = begin; first < end; first += EYE_FLEET_CHUNK) {
+            int n = end - first < EYE_FLEET_CHUNK ? end - first : EYE_FLEET_CHUNK;
+            for (int k = 0; k < n; k++) {
+                float p = phase[ids[first + k]];
+                valence[k] = sinf(time * 0.3f + p);
+                arousal[k] = cosf(time * 0.47f + p * 1.7f);
+            }
+            emotions.LookupBatch(valence, arousal, out + first, n);
+        }
+    }
+};
+
+// --- Camera ---
+// The world rectangle on screen and the world -> screen mapping (no rotation)
+struct FleetCamera {
+    Rectangle view;
+    float originX, originY, zoom;
+};
+
+FleetCamera CameraView(const Camera2D &camera, Rectangle screen) {
+    Vector2 topLeft = GetScreenToWorld2D(Vector2{ screen.x, screen.y }, camera);
+    FleetCamera out;
+    out.view = Rectangle{ topLeft.x, topLeft.y, screen.width / camera.zoom, screen.height / camera.zoom };
+    out.originX = camera.offset.x - camera.target.x * camera.zoom;
+    out.originY = camera.offset.y - camera.target.y * camera.zoom;
+    out.zoom = camera.zoom;
+    return out;
+}
+
+// Drag to pan, wheel to zoom around the cursor
+void UpdateFleetCamera(Camera2D &camera) {
+    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
+        Vector2 delta = GetMouseDelta();
+        camera.target.x -= delta.x / camera.zoom;
+        camera.target.y -= delta.y / camera.zoom;
+    }
+    float wheel = GetMouseWheelMove();
+    if (wheel != 0.0f) {
+        Vector2 mouse = GetMousePosition();
+        camera.target = GetScreenToWorld2D(mouse, camera);
+        camera.offset = mouse;
+        camera.zoom = fminf(fmaxf(camera.zoom * powf(1.25f, wheel), 0.25f), 2000.0f);
+    }
+}
+
+// --- Frame pipeline ---
+// Two frames: the front one is drawn while a job group fills the back one. Start culls
+// and hands the next frame to the workers; Finish waits for it (helping out) and swaps.
+// The fleet must not be resized between the two.
+struct FleetFrame {
+    EyeFleetView view;
+    EyeFleetLayout screen; // the fleet layout in screen pixels
+    std::vector<EyeConfig> cfgs;
+    EyeFleetMesh mesh;
+};
+
+struct FleetPipeline {
+    static const int Grain = 256; // faces per job, one EyeBatch chunk
+
+    JobSystem jobs;
+    std::vector<EyeFleetScratch> scratches;
+    FleetFrame frames[2];
+    JobGroup group;
+    int front = 0;
+    float maxRadius = 0.0f;
+
+    FleetPipeline() : scratches(jobs.Threads()) {
+        // Faces only ever blend the anchors, so their radii bound every face's
+        for (const EmotionAnchor &a : Emotion_DefaultAnchors) maxRadius = fmaxf(maxRadius, fmaxf(a.cfg.Radius_Top, a.cfg.Radius_Bottom));
+    }
+    ~FleetPipeline() { jobs.Wait(group); }
+
+    const FleetFrame &Front() const { return frames[front]; }
+
+    void Start(const Fleet &fleet, const EmotionGrid &emotions, const FleetCamera &camera, float time) {
+        FleetFrame &back = frames[front ^ 1];
+        EyeFleetCull(fleet.grid, fleet.layout, camera.view, camera.zoom, back.view);
+        back.screen = EyeFleetTransformed(fleet.layout, camera.originX, camera.originY, camera.zoom);
+        int count = (int)back.view.full.size();
+        back.cfgs.resize(count);
+        EyeFleetPrepare(count, maxRadius, back.screen, back.mesh);
+        jobs.Dispatch(group, count, Grain, [this, &fleet, &emotions, &back, time](int begin, int end) {
+            const int *ids = back.view.full.data();
+            fleet.Update(emotions, time, ids, begin, end, back.cfgs.data());
+            EyeFleetBuildList(back.cfgs.data(), ids, back.screen, back.mesh, begin, end, scratches[jobs.ThreadIndex()]);
+        });
+    }
+
+    void Finish() {
+        jobs.Wait(group);
+        front ^= 1;
+    }
+};
+
+// --- Drawing ---
+void DrawQuad(float x, float y, float w, float h, Color color) {
+    if (rlCheckRenderBatchLimit(4)) rlBegin(RL_QUADS);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    rlVertex2f(x, y);
+    rlVertex2f(x, y + h);
+    rlVertex2f(x + w, y + h);
+    rlVertex2f(x + w, y);
+}
+
+// One colour per face; rlgl starts a new draw call only when the next face won't fit
+void DrawFleet(const FleetFrame &frame, const Fleet &fleet) {
+    const EyeFleetMesh &mesh = frame.mesh;
+    rlBegin(RL_TRIANGLES);
+    for (int k = 0; k < mesh.count; k++) {
+        // A flush ends the draw; older rlgl forgets its mode, so begin again
+        if (rlCheckRenderBatchLimit(mesh.verticesPerFace)) rlBegin(RL_TRIANGLES);
+        const Vector2 *v = mesh.Face(k);
+        Color c = StatusColors[fleet.status[frame.view.full[k]]];
+        rlColor4ub(c.r, c.g, c.b, c.a);
+        for (int i = 0; i < mesh.verticesPerFace; i++) rlVertex2f(v[i].x, v[i].y);
+    }
+    rlEnd();
+
+    // Faces too small to read: a dot where the eyes would be, at least a pixel
+    rlBegin(RL_QUADS);
+    float dot = fmaxf(frame.screen.cellHeight * 0.6f, 1.0f);
+    for (int id : frame.view.dots) {
+        Vector2 c = frame.screen.FaceCenter(id);
+        DrawQuad(c.x - dot * 0.5f, c.y - dot * 0.5f, dot, dot, StatusColors[fleet.status[id]]);
+    }
+    // Faces below a pixel: one dot per grid cell
+    float zoom = frame.screen.cellWidth / fleet.layout.cellWidth;
+    float ox = frame.screen.x - fleet.layout.x * zoom, oy = frame.screen.y - fleet.layout.y * zoom;
+    for (int c : frame.view.cells) {
+        Rectangle r = fleet.grid.CellRect(c);
+        float size = fmaxf(r.width * zoom, 1.0f);
+        DrawQuad(r.x * zoom + ox, r.y * zoom + oy, size, size, StatusColors[fleet.cellStatus[c]]);
+    }
+    rlEnd();
+}
+
+// --- Benchmark scene ---
+// Unlocked frame rate, a short warm-up, then the average over `frames` for each count
+// and zoom. "wait ms" is how long the main thread spent joining the build per frame
+int RunBenchmark(const EmotionGrid &emotions) {
+    const int counts[] = { 1000, 10000, 100000, 1000000 };
+    const float zooms[] = { 1.0f, 16.0f };
+    const int warmup = 30, frames = 240;
+    Rectangle screen = { 0.0f, 0.0f, (float)GetScreenWidth(), (float)GetScreenHeight() };
+    Fleet fleet;
+    FleetPipeline pipeline;
+
+    printf("%d threads\n", pipeline.jobs.Threads());
+    printf("%-8s %5s %7s %8s %6s %8s %10s %9s\n", "faces", "zoom", "full", "dots", "cells", "fps", "ms/frame", "wait ms");
+    for (int count : counts) {
+        fleet.Resize(count, screen.width, screen.height);
+        for (float zoom : zooms) {
+            // Zoomed in on the middle of the wall
+            Camera2D camera = {};
+            camera.offset = Vector2{ screen.width * 0.5f, screen.height * 0.5f };
+            camera.target = camera.offset;
+            camera.zoom = zoom;
+            FleetCamera view = CameraView(camera, screen);
+
+            pipeline.Start(fleet, emotions, view, (float)GetTime());
+            double start = 0.0, wait = 0.0;
+            for (int f = 0; f < warmup + frames && !WindowShouldClose(); f++) {
+                if (f == warmup) {
+                    start = GetTime();
+                    wait = 0.0;
+                }
+                double t0 = GetTime();
+                pipeline.Finish();
+                wait += GetTime() - t0;
+                pipeline.Start(fleet, emotions, view, (float)t0);
+
+                BeginDrawing();
+                ClearBackground(BLACK);
+                DrawFleet(pipeline.Front(), fleet);
+                DrawText(TextFormat("benchmark: %d faces, zoom %.0f", count, zoom), 10, 10, 20, GRAY);
+                EndDrawing();
+            }
+            pipeline.Finish();
+            double elapsed = GetTime() - start;
+            const EyeFleetView &v = pipeline.Front().view;
+            printf("%-8d %5.0f %7zu %8zu %6zu %8.1f %10.2f %9.2f\n", count, zoom, v.full.size(), v.dots.size(), v.cells.size(),
+                   frames / elapsed, elapsed * 1000.0 / frames, wait * 1000.0 / frames);
+            fflush(stdout);
+        }
+    }
+    return 0;
+}
+
+// --- Main ---
+int main(int argc, char **argv) {
+    bool bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+    int count = argc > 1 && !bench ? atoi(argv[1]) : 10000;
+    if (count < 1) count = 1;
+
+    SetConfigFlags(bench ? 0 : FLAG_VSYNC_HINT);
+    InitWindow(1600, 900, "Fleet Dashboard");
+    EmotionGrid emotions;
+    if (bench) {
+        int result = RunBenchmark(emotions);
+        CloseWindow();
+        return result;
+    }
+
+    // Below the status line; the wall is laid out once to fit it at zoom 1
+    Rectangle screen = { 0.0f, 40.0f, (float)GetScreenWidth(), (float)GetScreenHeight() - 40.0f };
+    Camera2D home = {};
+    home.offset = Vector2{ screen.x, screen.y };
+    home.zoom = 1.0f;
+    Camera2D camera = home;
+
+    Fleet fleet;
+    fleet.Resize(count, screen.width, screen.height);
+    FleetPipeline pipeline;
+    pipeline.Start(fleet, emotions, CameraView(camera, screen), (float)GetTime());
+
+    while (!WindowShouldClose()) {
+        pipeline.Finish();
+        int resized = count;
+        if (IsKeyPressed(KEY_UP)) resized = count * 2;
+        if (IsKeyPressed(KEY_DOWN) && count > 1) resized = count / 2;
+        if (resized != count) {
+            // The front frame is for the old fleet: rebuild it before drawing
+            fleet.Resize(count = resized, screen.width, screen.height);
+            pipeline.Start(fleet, emotions, CameraView(camera, screen), (float)GetTime());
+            pipeline.Finish();
+        }
+        if (IsKeyPressed(KEY_R)) camera = home;
+        UpdateFleetCamera(camera);
+        pipeline.Start(fleet, emotions, CameraView(camera, screen), (float)GetTime());
+
+        const FleetFrame &frame = pipeline.Front();
+        BeginDrawing();
+        ClearBackground(BLACK);
+        DrawFleet(frame, fleet);
+        DrawText(TextFormat("%d faces, %d fps, zoom %.1f: %zu animated, %zu dots, %zu cells, %d threads", count, GetFPS(), camera.zoom,
+                            frame.view.full.size(), frame.view.dots.size(), frame.view.cells.size(), pipeline.jobs.Threads()),
+                 10, 10, 20, GRAY);
+        EndDrawing();
+    }
+
+    pipeline.Finish();
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <math.h>
+
+// Max distance in pixels between a tessellated arc and the true circle. Tighter than raylib's
+// own auto rule (about 0.75 px at radius 10), so small corners get more segments than before
+#define ARC_LOD_MAX_ERROR 0.25f
+// Segment cap per arc, so huge radii don't explode the vertex count
+#define ARC_LOD_MAX_SEGMENTS 64
+
+// Slow path of ArcSegmentCount for any arc angle and tolerance. A chord spanning angle t sags
+// r * (1 - cos(t / 2)) below the arc, so the largest allowed step is 2 * acos(1 - maxError / r).
+inline int ArcSegmentCountExact(float radius, float arcDegrees, float maxError)
+{
+    if (radius <= maxError) return 1;
+
+    float maxStep = 2.0f * acosf(1.0f - maxError / radius);
+    int segments = (int)ceilf(arcDegrees * (3.14159265f / 180.0f) / maxStep);
+
+    if (segments < 1) segments = 1;
+    if (segments > ARC_LOD_MAX_SEGMENTS) segments = ARC_LOD_MAX_SEGMENTS;
+    return segments;
+}
+
+// --- Compile-time trig ---
+// Taylor series, only ever evaluated by the compiler: arcLodRadii below and the direction
+// tables in arc_tables.h. Arguments stay in [0, pi/2], where 8 terms are exact to float precision.
+constexpr double ArcTableSin(double x) {
+    double term = x, sum = x;
+    for (int n = 1; n < 9; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double ArcTableCos(double x) {
+    double term = 1.0, sum = 1.0;
+    for (int n = 1; n < 9; n++) {
+        term *= -x * x / ((2 * n - 1) * (2 * n));
+        sum += term;
+    }
+    return sum;
+}
+
+// --- Quarter-arc radius thresholds ---
+// Every caller asks for 90 degree corners at ARC_LOD_MAX_ERROR, so the answer only depends on
+// the radius: n segments hold the tolerance up to radius maxError / (1 - cos(pi / 4n)).
+// Baked by the compiler, so picking a count per corner per frame is a short search, no acosf.
+struct ArcLodRadii {
+    float maxRadius[ARC_LOD_MAX_SEGMENTS + 1] = {}; // [n]: largest radius n segments cover
+
+    constexpr ArcLodRadii() {
+        for (int n = 1; n <= ARC_LOD_MAX_SEGMENTS; n++) {
+            maxRadius[n] = (float)(ARC_LOD_MAX_ERROR / (1.0 - ArcTableCos(3.14159265358979323846 / (4.0 * n))));
+        }
+    }
+};
+
+inline constexpr ArcLodRadii arcLodRadii{};
+
+// ArcSegmentCount: Fewest segments that keep an arc of the given on-screen radius
+// within maxError pixels of the circle. Quarter arcs at the default tolerance come from
+// arcLodRadii; anything else takes the acosf path.
+inline int ArcSegmentCount(float radius, float arcDegrees = 90.0f, float maxError = ARC_LOD_MAX_ERROR)
+{
+    if (arcDegrees != 90.0f || maxError != ARC_LOD_MAX_ERROR) return ArcSegmentCountExact(radius, arcDegrees, maxError);
+    if (!(radius > arcLodRadii.maxRadius[1])) return 1; // also catches NaN
+
+    // Smallest n in (1, max] with radius <= maxRadius[n]
+    int lo = 2, hi = ARC_LOD_MAX_SEGMENTS;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (radius <= arcLodRadii.maxRadius[mid]) hi = mid;
+        else lo = mid + 1;
+    }
+    return lo;
+}
+
+// Same convention as raylib's shape functions: segments <= 0 means "pick for me"
+inline int ArcSegmentsOrAuto(int segments, float radius, float arcDegrees = 90.0f)
+{
+    return (segments > 0) ? segments : ArcSegmentCount(radius, arcDegrees);
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "arc_lod.h"
+#include "raylib_types.h"
+
+// Largest per-corner segment count with a baked table (matches the LOD cap)
+#define ARC_TABLE_MAX_SEGMENTS ARC_LOD_MAX_SEGMENTS
+
+// First entry of the table for `segments` in the flat array: tables 1..segments-1 hold (s + 1) points each
+constexpr int ArcTableOffset(int segments) { return (segments - 1) * (segments + 2) / 2; }
+
+// --- Quarter-circle direction tables ---
+// For every segment count s in [1, ARC_TABLE_MAX_SEGMENTS], the s + 1 unit directions
+// at angles 0, 90/s, ..., 90 degrees (first quadrant, y down like raylib).
+struct QuarterArcTables {
+    Vector2 dir[ArcTableOffset(ARC_TABLE_MAX_SEGMENTS + 1)] = {};
+
+    constexpr QuarterArcTables() {
+        for (int s = 1; s <= ARC_TABLE_MAX_SEGMENTS; s++) {
+            for (int i = 0; i <= s; i++) {
+                double angle = (3.14159265358979323846 / 2.0) * i / s;
+                dir[ArcTableOffset(s) + i] = Vector2{ (float)ArcTableCos(angle), (float)ArcTableSin(angle) };
+            }
+        }
+    }
+};
+
+inline constexpr QuarterArcTables quarterArcTables{};
+
+// Directions for one quarter arc split into `segments` pieces (clamped to the baked range)
+inline const Vector2 *QuarterArcDirections(int segments) {
+    if (segments < 1) segments = 1;
+    if (segments > ARC_TABLE_MAX_SEGMENTS) segments = ARC_TABLE_MAX_SEGMENTS;
+    return &quarterArcTables.dir[ArcTableOffset(segments)];
+}
+
+// Rotates a first-quadrant direction into quadrant q (0: 0-90, 1: 90-180, 2: 180-270, 3: 270-360 degrees)
+constexpr Vector2 ArcTableRotate(Vector2 d, int quadrant) {
+    switch (quadrant & 3) {
+        case 1: return Vector2{ -d.y, d.x };
+        case 2: return Vector2{ -d.x, -d.y };
+        case 3: return Vector2{ d.y, -d.x };
+        default: return d;
+    }
+}
+
+// Point i of the quarter arc starting at quadrant * 90 degrees: scale and translate only
+inline Vector2 ArcTablePoint(const Vector2 *dir, int i, int quadrant, Vector2 center, float radius) {
+    Vector2 d = ArcTableRotate(dir[i], quadrant);
+    return Vector2{ center.x + d.x * radius, center.y + d.y * radius };
+}
+
+// --- Star direction tables ---
+// 2 * Points unit directions alternating outer/inner vertex, starting straight up
+// (-90 degrees) and stepping 180 / Points degrees, as PolygonDrawer::DrawStar lays them out.
+template <int Points>
+struct StarTable {
+    Vector2 dir[2 * Points] = {};
+
+    constexpr StarTable() {
+        for (int i = 0; i < 2 * Points; i++) {
+            // Fold the angle into the first quadrant, then rotate it back out
+            double degrees = 270.0 + i * 180.0 / Points; // -90 == 270
+            while (degrees >= 360.0) degrees -= 360.0;
+            int quadrant = (int)(degrees / 90.0);
+            double angle = (degrees - quadrant * 90.0) * (3.14159265358979323846 / 180.0);
+            dir[i] = ArcTableRotate(Vector2{ (float)ArcTableCos(angle), (float)ArcTableSin(angle) }, quadrant);
+        }
+    }
+};
+
+template <int Points>
+inline constexpr StarTable<Points> starTable{};
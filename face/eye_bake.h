@@ -0,0 +1,156 @@
+#pragma once
+#include "eye_mesh.h"
+#include "oled_delta.h"
+#include "soft_raster.h"
+#include <stdint.h>
+#include <vector>
+
+// --- Baked clips ---
+// Canned animations rendered once, offline and headless, so playback does no geometry
+// at all. Frames come from dense poses (EyeCurveSampleClip, EyeCurveClip::SampleFrame,
+// or any per-frame source) and go through the software rasterizer, which follows
+// EyeDrawer's geometry: left eye at centre - spacing, right eye from EyeConfigRight.
+//   EyeFrameAtlas   GRAY8 frames in a grid; playback blits one cell (upload the canvas
+//                   as a texture and DrawTextureRec with FrameRect)
+//   EyeFrameStream  1-bpp SSD1306 frames as OLED delta packets, with a keyframe every
+//                   keyInterval frames so any frame is reachable without the whole past
+
+// Where the eyes sit in a frame
+struct EyeBakeLayout {
+    int width = OLED_WIDTH, height = OLED_HEIGHT;
+    float spacing = 32.0f; // eye centres at width / 2 -+ spacing
+    Color background = { 0, 0, 0, 255 };
+    Color color = { 255, 255, 255, 255 };
+};
+
+// Both eyes of one pose, clipped to `cell` and centred in it
+inline void EyeBakeDraw(SoftCanvas &canvas, const SoftRect &cell, const EyeConfig &cfg, const EyeBakeLayout &layout) {
+    float cx = cell.x + cell.width * 0.5f, cy = cell.y + cell.height * 0.5f;
+    SoftDrawEye(canvas, cx - layout.spacing, cy, cfg, layout.color, &cell);
+    SoftDrawEye(canvas, cx + layout.spacing, cy, EyeConfigRight(cfg), layout.color, &cell);
+}
+
+// --- EyeFrameAtlas ---
+struct EyeFrameAtlas {
+    SoftCanvas canvas; // GRAY8
+    int frameWidth = 0, frameHeight = 0;
+    int columns = 0, frameCount = 0;
+    float fps = 60.0f;
+
+    SoftRect FrameRect(int frame) const {
+        return SoftRect{ (frame % columns) * frameWidth, (frame / columns) * frameHeight, frameWidth, frameHeight };
+    }
+
+    // Frame shown at `time` seconds, looping or held on the last frame; -1 for an empty atlas
+    int FrameAt(float time, bool loop) const {
+        if (frameCount <= 0) return -1;
+        int frame = time > 0.0f ? (int)(time * fps) : 0;
+        return loop ? frame % frameCount : (frame < frameCount ? frame : frameCount - 1);
+    }
+
+    // Copies one frame out as tightly packed rows; out-of-range frames copy nothing
+    void CopyFrame(int frame, uint8_t *out) const {
+        if (frame < 0 || frame >= frameCount) return;
+        SoftRect r = FrameRect(frame);
+        for (int y = 0; y < r.height; y++) memcpy(out + y * r.width, &canvas.pixels[(size_t)(r.y + y) * canvas.Stride() + r.x], r.width);
+    }
+};
+
+// EyeBakeAtlas: Renders `count` poses into a grid of at most maxWidth pixels across
+inline void EyeBakeAtlas(const EyeConfig *poses, int count, float fps, const EyeBakeLayout &layout, EyeFrameAtlas &out, int maxWidth = 4096) {
+    out.frameWidth = layout.width;
+    out.frameHeight = layout.height;
+    out.columns = maxWidth / layout.width;
+    if (out.columns < 1) out.columns = 1;
+    if (out.columns > count) out.columns = count > 0 ? count : 1;
+    out.frameCount = count;
+    out.fps = fps;
+    int rows = (count + out.columns - 1) / out.columns;
+    out.canvas.Resize(out.columns * layout.width, rows * layout.height, SOFT_GRAY8);
+    out.canvas.Clear(layout.background);
+
+    // Each frame is drawn at the origin of its own canvas and copied in, so a cell holds
+    // exactly the pixels a live render would (float rounding shifts with the position)
+    SoftCanvas frame(layout.width, layout.height, SOFT_GRAY8);
+    for (int i = 0; i < count; i++) {
+        frame.Clear(layout.background);
+        EyeBakeDraw(frame, frame.Bounds(), poses[i], layout);
+        SoftRect r = out.FrameRect(i);
+        for (int y = 0; y < r.height; y++) memcpy(&out.canvas.pixels[(size_t)(r.y + y) * out.canvas.Stride() + r.x], &frame.pixels[(size_t)y * frame.Stride()], r.width);
+    }
+}
+
+// --- EyeFrameStream ---
+struct EyeFrameStream {
+    std::vector<uint8_t> data;     // packets back to back
+    std::vector<uint32_t> offsets; // packet i is data[offsets[i], offsets[i + 1])
+    int keyInterval = 60;
+    float fps = 60.0f;
+
+    int FrameCount() const { return offsets.empty() ? 0 : (int)offsets.size() - 1; }
+    const uint8_t *Packet(int frame) const { return data.data() + offsets[frame]; }
+    int PacketSize(int frame) const { return (int)(offsets[frame + 1] - offsets[frame]); }
+};
+
+// EyeBakeStream: Renders `count` poses at OLED size and encodes them as delta packets
+inline void EyeBakeStream(const EyeConfig *poses, int count, float fps, const EyeBakeLayout &layout, int keyInterval, EyeFrameStream &out, uint8_t threshold = 127) {
+    EyeBakeLayout oled = layout;
+    oled.width = OLED_WIDTH;
+    oled.height = OLED_HEIGHT;
+    out.data.clear();
+    out.offsets.assign(1, 0);
+    out.keyInterval = keyInterval > 0 ? keyInterval : 1;
+    out.fps = fps;
+
+    SoftCanvas canvas(OLED_WIDTH, OLED_HEIGHT, SOFT_GRAY8);
+    OledFrame prev, cur;
+    uint8_t packet[OLED_DELTA_MAX_BYTES];
+    for (int i = 0; i < count; i++) {
+        canvas.Clear(oled.background);
+        EyeBakeDraw(canvas, canvas.Bounds(), poses[i], oled);
+        OledEncodeCanvas(canvas, threshold, cur);
+        int size = OledDeltaEncode(i % out.keyInterval ? &prev : nullptr, cur, packet);
+        out.data.insert(out.data.end(), packet, packet + size);
+        out.offsets.push_back((uint32_t)out.data.size());
+        prev = cur;
+    }
+}
+
+// --- EyeStreamPlayer ---
+// Plays a stream into one OledFrame. Stepping forward applies one packet per frame;
+// a seek decodes from the keyframe at or before the target, or from the current frame
+// if that is already past the keyframe.
+struct EyeStreamPlayer {
+    const EyeFrameStream *stream = nullptr;
+    OledFrame display = {};
+    int frame = -1;
+
+    void Attach(const EyeFrameStream &s) {
+        stream = &s;
+        frame = -1;
+    }
+
+    // EyeStreamPlayer::Seek: Display contents at `target`; false on a corrupt packet or a
+    // target outside the stream (the display is left as it was)
+    bool Seek(int target) {
+        if (!stream || target < 0 || target >= stream->FrameCount()) return false;
+        if (target == frame) return true;
+        int key = target - target % stream->keyInterval;
+        int from = (frame >= key && frame < target) ? frame + 1 : key;
+        for (int i = from; i <= target; i++) {
+            if (!OledDeltaDecode(stream->Packet(i), stream->PacketSize(i), display)) {
+                frame = -1;
+                return false;
+            }
+        }
+        frame = target;
+        return true;
+    }
+
+    bool SeekTime(float time, bool loop) {
+        int count = stream ? stream->FrameCount() : 0;
+        if (count == 0) return false;
+        int target = time > 0.0f ? (int)(time * stream->fps) : 0;
+        return Seek(loop ? target % count : (target < count ? target : count - 1));
+    }
+};
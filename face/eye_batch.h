@@ -0,0 +1,217 @@
+#pragma once
+#include "arc_lod.h"
+#include "arc_tables.h"
+#include "eye_config.h"
+#include "simd_dispatch.h"
+#include <vector>
+
+// --- EyeBatch ---
+// Many eyes in structure-of-arrays form: one array per EyeConfig float field plus the
+// eye centre. Geometry for the whole batch comes out of one call, 4 or 8 eyes per
+// instruction, instead of one Vector2 at a time inside EyeDrawer::Draw.
+struct EyeBatch {
+    int count = 0;
+    std::vector<float> CenterX, CenterY;
+    std::vector<float> OffsetX, OffsetY, Height, Width;
+    std::vector<float> Slope_Top, Slope_Bottom, Radius_Top, Radius_Bottom;
+
+    void Resize(int n) {
+        count = n;
+        for (std::vector<float> *field : { &CenterX, &CenterY, &OffsetX, &OffsetY, &Height, &Width,
+                                           &Slope_Top, &Slope_Bottom, &Radius_Top, &Radius_Bottom }) {
+            field->resize(n);
+        }
+    }
+
+    void Set(int i, float centerX, float centerY, const EyeConfig &cfg) {
+        CenterX[i] = centerX;        CenterY[i] = centerY;
+        OffsetX[i] = cfg.OffsetX;    OffsetY[i] = cfg.OffsetY;
+        Height[i] = cfg.Height;      Width[i] = cfg.Width;
+        Slope_Top[i] = cfg.Slope_Top;     Slope_Bottom[i] = cfg.Slope_Bottom;
+        Radius_Top[i] = cfg.Radius_Top;   Radius_Bottom[i] = cfg.Radius_Bottom;
+    }
+};
+
+// Outline vertices for every eye of a batch, vertex-major: vertex v of eye e is at
+// x[v * count + e], so each SIMD store writes the same vertex of neighbouring eyes.
+// Per eye the outline runs counter-clockwise on screen (raylib's front face):
+// TL arc, left edge, BL arc, bottom edge, BR arc, right edge, TR arc, top edge.
+struct EyeBatchVertices {
+    int count = 0;          // eyes
+    int segments = 0;       // arc segments per corner
+    int verticesPerEye = 0; // 4 * (segments + 1)
+    std::vector<float> x, y;
+
+    Vector2 Vertex(int eye, int v) const { return Vector2{ x[v * count + eye], y[v * count + eye] }; }
+};
+
+// Per-vertex constants shared by every eye: which corner it hangs off and its unit direction
+struct EyeBatchVertexDirs {
+    std::vector<int> corner; // 0 TL, 1 BL, 2 BR, 3 TR
+    std::vector<float> dx, dy;
+
+    explicit EyeBatchVertexDirs(int segments) {
+        static const int quadrants[4] = { 2, 1, 0, 3 }; // TL, BL, BR, TR
+        const Vector2 *dir = QuarterArcDirections(segments);
+        for (int c = 0; c < 4; c++) {
+            for (int i = segments; i >= 0; i--) {
+                Vector2 d = ArcTableRotate(dir[i], quadrants[c]);
+                corner.push_back(c);
+                dx.push_back(d.x);
+                dy.push_back(d.y);
+            }
+        }
+    }
+};
+
+// Scalar kernel, also used for the tail the vector kernels leave over
+inline void EyeBatchKernelScalar(const EyeBatch &batch, const EyeBatchVertexDirs &dirs, EyeBatchVertices &out, int begin, int end) {
+    int n = out.count;
+    int vertices = out.verticesPerEye;
+    for (int e = begin; e < end; e++) {
+        float deltaTop = batch.Height[e] * batch.Slope_Top[e] * 0.5f;
+        float deltaBottom = batch.Height[e] * batch.Slope_Bottom[e] * 0.5f;
+        float totalHeight = batch.Height[e] + deltaTop - deltaBottom;
+
+        float rTop = batch.Radius_Top[e];
+        float rBottom = batch.Radius_Bottom[e];
+        if (rTop + rBottom > totalHeight - 1) {
+            float scale = (totalHeight - 1) / (rTop + rBottom);
+            rTop *= scale;
+            rBottom *= scale;
+        }
+
+        float cx = batch.CenterX[e] + batch.OffsetX[e];
+        float cy = batch.CenterY[e] + batch.OffsetY[e];
+        float halfW = batch.Width[e] * 0.5f;
+        float halfH = batch.Height[e] * 0.5f;
+
+        // Corner centres and radii in EyeBatchVertexDirs order: TL, BL, BR, TR
+        float ccx[4] = { cx - halfW + rTop, cx - halfW + rBottom, cx + halfW - rBottom, cx + halfW - rTop };
+        float ccy[4] = { cy - halfH + rTop - deltaTop, cy + halfH - rBottom - deltaBottom,
+                         cy + halfH - rBottom + deltaBottom, cy - halfH + rTop + deltaTop };
+        float cr[4] = { rTop, rBottom, rBottom, rTop };
+
+        for (int v = 0; v < vertices; v++) {
+            int c = dirs.corner[v];
+            out.x[v * n + e] = ccx[c] + cr[c] * dirs.dx[v];
+            out.y[v * n + e] = ccy[c] + cr[c] * dirs.dy[v];
+        }
+    }
+}
+
+#if FACE_SIMD_X86
+// SSE2 kernel: 4 eyes per iteration. Returns the first eye it did not process.
+inline int EyeBatchKernelSSE2(const EyeBatch &batch, const EyeBatchVertexDirs &dirs, EyeBatchVertices &out) {
+    int n = out.count;
+    int vertices = out.verticesPerEye;
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    int e = 0;
+    for (; e + 4 <= n; e += 4) {
+        __m128 height = _mm_loadu_ps(&batch.Height[e]);
+        __m128 deltaTop = _mm_mul_ps(_mm_mul_ps(height, _mm_loadu_ps(&batch.Slope_Top[e])), half);
+        __m128 deltaBottom = _mm_mul_ps(_mm_mul_ps(height, _mm_loadu_ps(&batch.Slope_Bottom[e])), half);
+        __m128 limit = _mm_sub_ps(_mm_sub_ps(_mm_add_ps(height, deltaTop), deltaBottom), one);
+
+        __m128 rTop = _mm_loadu_ps(&batch.Radius_Top[e]);
+        __m128 rBottom = _mm_loadu_ps(&batch.Radius_Bottom[e]);
+        __m128 rSum = _mm_add_ps(rTop, rBottom);
+        __m128 clamp = _mm_cmpgt_ps(rSum, limit);
+        __m128 scale = _mm_or_ps(_mm_and_ps(clamp, _mm_div_ps(limit, rSum)), _mm_andnot_ps(clamp, one));
+        rTop = _mm_mul_ps(rTop, scale);
+        rBottom = _mm_mul_ps(rBottom, scale);
+
+        __m128 cx = _mm_add_ps(_mm_loadu_ps(&batch.CenterX[e]), _mm_loadu_ps(&batch.OffsetX[e]));
+        __m128 cy = _mm_add_ps(_mm_loadu_ps(&batch.CenterY[e]), _mm_loadu_ps(&batch.OffsetY[e]));
+        __m128 halfW = _mm_mul_ps(_mm_loadu_ps(&batch.Width[e]), half);
+        __m128 halfH = _mm_mul_ps(height, half);
+        __m128 left = _mm_sub_ps(cx, halfW), right = _mm_add_ps(cx, halfW);
+        __m128 top = _mm_sub_ps(cy, halfH), bottom = _mm_add_ps(cy, halfH);
+
+        __m128 ccx[4] = { _mm_add_ps(left, rTop), _mm_add_ps(left, rBottom), _mm_sub_ps(right, rBottom), _mm_sub_ps(right, rTop) };
+        __m128 ccy[4] = { _mm_sub_ps(_mm_add_ps(top, rTop), deltaTop), _mm_sub_ps(_mm_sub_ps(bottom, rBottom), deltaBottom),
+                          _mm_add_ps(_mm_sub_ps(bottom, rBottom), deltaBottom), _mm_add_ps(_mm_add_ps(top, rTop), deltaTop) };
+        __m128 cr[4] = { rTop, rBottom, rBottom, rTop };
+
+        for (int v = 0; v < vertices; v++) {
+            int c = dirs.corner[v];
+            _mm_storeu_ps(&out.x[v * n + e], _mm_add_ps(ccx[c], _mm_mul_ps(cr[c], _mm_set1_ps(dirs.dx[v]))));
+            _mm_storeu_ps(&out.y[v * n + e], _mm_add_ps(ccy[c], _mm_mul_ps(cr[c], _mm_set1_ps(dirs.dy[v]))));
+        }
+    }
+    return e;
+}
+
+// AVX2 kernel: 8 eyes per iteration, FMA for the scale + translate
+FACE_TARGET_AVX2 inline int EyeBatchKernelAVX2(const EyeBatch &batch, const EyeBatchVertexDirs &dirs, EyeBatchVertices &out) {
+    int n = out.count;
+    int vertices = out.verticesPerEye;
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    int e = 0;
+    for (; e + 8 <= n; e += 8) {
+        __m256 height = _mm256_loadu_ps(&batch.Height[e]);
+        __m256 deltaTop = _mm256_mul_ps(_mm256_mul_ps(height, _mm256_loadu_ps(&batch.Slope_Top[e])), half);
+        __m256 deltaBottom = _mm256_mul_ps(_mm256_mul_ps(height, _mm256_loadu_ps(&batch.Slope_Bottom[e])), half);
+        __m256 limit = _mm256_sub_ps(_mm256_sub_ps(_mm256_add_ps(height, deltaTop), deltaBottom), one);
+
+        __m256 rTop = _mm256_loadu_ps(&batch.Radius_Top[e]);
+        __m256 rBottom = _mm256_loadu_ps(&batch.Radius_Bottom[e]);
+        __m256 rSum = _mm256_add_ps(rTop, rBottom);
+        __m256 scale = _mm256_blendv_ps(one, _mm256_div_ps(limit, rSum), _mm256_cmp_ps(rSum, limit, _CMP_GT_OQ));
+        rTop = _mm256_mul_ps(rTop, scale);
+        rBottom = _mm256_mul_ps(rBottom, scale);
+
+        __m256 cx = _mm256_add_ps(_mm256_loadu_ps(&batch.CenterX[e]), _mm256_loadu_ps(&batch.OffsetX[e]));
+        __m256 cy = _mm256_add_ps(_mm256_loadu_ps(&batch.CenterY[e]), _mm256_loadu_ps(&batch.OffsetY[e]));
+        __m256 halfW = _mm256_mul_ps(_mm256_loadu_ps(&batch.Width[e]), half);
+        __m256 halfH = _mm256_mul_ps(height, half);
+        __m256 left = _mm256_sub_ps(cx, halfW), right = _mm256_add_ps(cx, halfW);
+        __m256 top = _mm256_sub_ps(cy, halfH), bottom = _mm256_add_ps(cy, halfH);
+
+        __m256 ccx[4] = { _mm256_add_ps(left, rTop), _mm256_add_ps(left, rBottom), _mm256_sub_ps(right, rBottom), _mm256_sub_ps(right, rTop) };
+        __m256 ccy[4] = { _mm256_sub_ps(_mm256_add_ps(top, rTop), deltaTop), _mm256_sub_ps(_mm256_sub_ps(bottom, rBottom), deltaBottom),
+                          _mm256_add_ps(_mm256_sub_ps(bottom, rBottom), deltaBottom), _mm256_add_ps(_mm256_add_ps(top, rTop), deltaTop) };
+        __m256 cr[4] = { rTop, rBottom, rBottom, rTop };
+
+        for (int v = 0; v < vertices; v++) {
+            int c = dirs.corner[v];
+            _mm256_storeu_ps(&out.x[v * n + e], _mm256_fmadd_ps(cr[c], _mm256_set1_ps(dirs.dx[v]), ccx[c]));
+            _mm256_storeu_ps(&out.y[v * n + e], _mm256_fmadd_ps(cr[c], _mm256_set1_ps(dirs.dy[v]), ccy[c]));
+        }
+    }
+    return e;
+}
+#endif
+
+// EyeBatchGenerate: Outline vertices of every eye in the batch with `segments` per corner
+// (<= 0: picked from the largest radius in the batch). level defaults to the best the CPU has.
+inline void EyeBatchGenerate(const EyeBatch &batch, int segments, EyeBatchVertices &out, SimdLevel level = DetectSimdLevel()) {
+    if (segments <= 0) {
+        float maxRadius = 0.0f;
+        for (int e = 0; e < batch.count; e++) {
+            maxRadius = fmaxf(maxRadius, fmaxf(batch.Radius_Top[e], batch.Radius_Bottom[e]));
+        }
+        segments = ArcSegmentCount(maxRadius);
+    }
+    if (segments > ARC_TABLE_MAX_SEGMENTS) segments = ARC_TABLE_MAX_SEGMENTS;
+
+    out.count = batch.count;
+    out.segments = segments;
+    out.verticesPerEye = 4 * (segments + 1);
+    out.x.resize((size_t)out.verticesPerEye * batch.count);
+    out.y.resize((size_t)out.verticesPerEye * batch.count);
+
+    EyeBatchVertexDirs dirs(segments);
+    int done = 0;
+#if FACE_SIMD_X86
+    if (level >= SIMD_AVX2) done = EyeBatchKernelAVX2(batch, dirs, out);
+    else if (level >= SIMD_SSE2) done = EyeBatchKernelSSE2(batch, dirs, out);
+#else
+    (void)level;
+#endif
+    EyeBatchKernelScalar(batch, dirs, out, done, batch.count);
+}
@@ -0,0 +1,223 @@
+#pragma once
+#include "eye_config.h"
+#include "simd_dispatch.h"
+#include <stdint.h>
+#include <vector>
+
+// --- Blend tree ---
+// Layers stacked on a base expression for many faces at once. Each layer touches a mask
+// of EyeConfig fields and has a weight per face:
+//   EYE_BLEND_OVERRIDE  field = lerp(field, value, w)   emotion slopes, radii
+//   EYE_BLEND_ADD       field += value * w              gaze on OffsetX/OffsetY
+//   EYE_BLEND_MULTIPLY  field *= lerp(1, value, w)      blink squash on Height
+// Layers apply in the order they were added. Everything is structure-of-arrays, one
+// array per (layer, field) across faces, so a frame is one pass of 4 or 8 faces per
+// instruction over the whole tree.
+enum EyeBlendMode {
+    EYE_BLEND_OVERRIDE = 0,
+    EYE_BLEND_ADD,
+    EYE_BLEND_MULTIPLY
+};
+
+// EyeConfig float fields in struct order
+enum EyeField {
+    EYE_FIELD_OFFSET_X = 0,
+    EYE_FIELD_OFFSET_Y,
+    EYE_FIELD_HEIGHT,
+    EYE_FIELD_WIDTH,
+    EYE_FIELD_SLOPE_TOP,
+    EYE_FIELD_SLOPE_BOTTOM,
+    EYE_FIELD_RADIUS_TOP,
+    EYE_FIELD_RADIUS_BOTTOM,
+    EYE_FIELD_COUNT
+};
+
+#define EYE_FIELD_BIT(field) (1u << (field))
+#define EYE_FIELDS_GAZE (EYE_FIELD_BIT(EYE_FIELD_OFFSET_X) | EYE_FIELD_BIT(EYE_FIELD_OFFSET_Y))
+#define EYE_FIELDS_SLOPES (EYE_FIELD_BIT(EYE_FIELD_SLOPE_TOP) | EYE_FIELD_BIT(EYE_FIELD_SLOPE_BOTTOM))
+#define EYE_FIELDS_ALL ((1u << EYE_FIELD_COUNT) - 1)
+
+// What the kernels see of one layer; field k of face i is values[k * stride + i]
+struct EyeBlendLayerData {
+    EyeBlendMode mode;
+    uint32_t mask;
+    const float *values;
+    const float *weights;
+};
+
+// Scalar kernel, also used for the tail the vector kernels leave over. layers[0] is the base.
+inline void EyeBlendScalar(const EyeBlendLayerData *layers, int layerCount, int stride, EyeConfig *out, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+        float *o = &out[i].OffsetX;
+        for (int k = 0; k < EYE_FIELD_COUNT; k++) {
+            float acc = layers[0].values[k * stride + i];
+            for (int l = 1; l < layerCount; l++) {
+                const EyeBlendLayerData &layer = layers[l];
+                if (!(layer.mask & EYE_FIELD_BIT(k))) continue;
+                float v = layer.values[k * stride + i], w = layer.weights[i];
+                switch (layer.mode) {
+                    case EYE_BLEND_ADD: acc += v * w; break;
+                    case EYE_BLEND_MULTIPLY: acc *= 1.0f + (v - 1.0f) * w; break;
+                    default: acc += (v - acc) * w; break;
+                }
+            }
+            o[k] = acc;
+        }
+    }
+}
+
+#if FACE_SIMD_X86
+// SSE2 kernel: 4 faces per vector, transposed 4x4 into the AoS output
+inline int EyeBlendSSE2(const EyeBlendLayerData *layers, int layerCount, int stride, EyeConfig *out, int count) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 field[EYE_FIELD_COUNT];
+        for (int k = 0; k < EYE_FIELD_COUNT; k++) field[k] = _mm_loadu_ps(layers[0].values + k * stride + i);
+        for (int l = 1; l < layerCount; l++) {
+            const EyeBlendLayerData &layer = layers[l];
+            __m128 w = _mm_loadu_ps(layer.weights + i);
+            for (int k = 0; k < EYE_FIELD_COUNT; k++) {
+                if (!(layer.mask & EYE_FIELD_BIT(k))) continue;
+                __m128 v = _mm_loadu_ps(layer.values + k * stride + i);
+                switch (layer.mode) {
+                    case EYE_BLEND_ADD: field[k] = _mm_add_ps(field[k], _mm_mul_ps(v, w)); break;
+                    case EYE_BLEND_MULTIPLY: field[k] = _mm_mul_ps(field[k], _mm_add_ps(one, _mm_mul_ps(_mm_sub_ps(v, one), w))); break;
+                    default: field[k] = _mm_add_ps(field[k], _mm_mul_ps(_mm_sub_ps(v, field[k]), w)); break;
+                }
+            }
+        }
+        // Fields 0-3 and 4-7 of the four faces
+        _MM_TRANSPOSE4_PS(field[0], field[1], field[2], field[3]);
+        _MM_TRANSPOSE4_PS(field[4], field[5], field[6], field[7]);
+        for (int j = 0; j < 4; j++) {
+            _mm_storeu_ps(&out[i + j].OffsetX, field[j]);
+            _mm_storeu_ps(&out[i + j].OffsetX + 4, field[4 + j]);
+        }
+    }
+    return i;
+}
+
+// AVX2 kernel: 8 faces per vector, transposed 8x8 so each face is one 256-bit store
+FACE_TARGET_AVX2 inline int EyeBlendAVX2(const EyeBlendLayerData *layers, int layerCount, int stride, EyeConfig *out, int count) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 r[EYE_FIELD_COUNT];
+        for (int k = 0; k < EYE_FIELD_COUNT; k++) r[k] = _mm256_loadu_ps(layers[0].values + k * stride + i);
+        for (int l = 1; l < layerCount; l++) {
+            const EyeBlendLayerData &layer = layers[l];
+            __m256 w = _mm256_loadu_ps(layer.weights + i);
+            for (int k = 0; k < EYE_FIELD_COUNT; k++) {
+                if (!(layer.mask & EYE_FIELD_BIT(k))) continue;
+                __m256 v = _mm256_loadu_ps(layer.values + k * stride + i);
+                switch (layer.mode) {
+                    case EYE_BLEND_ADD: r[k] = _mm256_fmadd_ps(v, w, r[k]); break;
+                    case EYE_BLEND_MULTIPLY: r[k] = _mm256_mul_ps(r[k], _mm256_fmadd_ps(_mm256_sub_ps(v, one), w, one)); break;
+                    default: r[k] = _mm256_fmadd_ps(_mm256_sub_ps(v, r[k]), w, r[k]); break;
+                }
+            }
+        }
+
+        __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]), t1 = _mm256_unpackhi_ps(r[0], r[1]);
+        __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]), t3 = _mm256_unpackhi_ps(r[2], r[3]);
+        __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]), t5 = _mm256_unpackhi_ps(r[4], r[5]);
+        __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]), t7 = _mm256_unpackhi_ps(r[6], r[7]);
+        __m256 s0 = _mm256_shuffle_ps(t0, t2, 0x44), s1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+        __m256 s2 = _mm256_shuffle_ps(t1, t3, 0x44), s3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+        __m256 s4 = _mm256_shuffle_ps(t4, t6, 0x44), s5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+        __m256 s6 = _mm256_shuffle_ps(t5, t7, 0x44), s7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+        _mm256_storeu_ps(&out[i + 0].OffsetX, _mm256_permute2f128_ps(s0, s4, 0x20));
+        _mm256_storeu_ps(&out[i + 1].OffsetX, _mm256_permute2f128_ps(s1, s5, 0x20));
+        _mm256_storeu_ps(&out[i + 2].OffsetX, _mm256_permute2f128_ps(s2, s6, 0x20));
+        _mm256_storeu_ps(&out[i + 3].OffsetX, _mm256_permute2f128_ps(s3, s7, 0x20));
+        _mm256_storeu_ps(&out[i + 4].OffsetX, _mm256_permute2f128_ps(s0, s4, 0x31));
+        _mm256_storeu_ps(&out[i + 5].OffsetX, _mm256_permute2f128_ps(s1, s5, 0x31));
+        _mm256_storeu_ps(&out[i + 6].OffsetX, _mm256_permute2f128_ps(s2, s6, 0x31));
+        _mm256_storeu_ps(&out[i + 7].OffsetX, _mm256_permute2f128_ps(s3, s7, 0x31));
+    }
+    return i;
+}
+#endif
+
+// --- EyeBlendTree ---
+class EyeBlendTree {
+public:
+    // n faces, all at `base`; drops every layer but the base
+    void Resize(int n, const EyeConfig &base) {
+        count = n;
+        stride = (n + 7) & ~7;
+        layers.clear();
+        layers.push_back(Layer{ EYE_BLEND_OVERRIDE, EYE_FIELDS_ALL, {}, std::vector<float>(stride, 1.0f) });
+        layers[0].values.assign((size_t)EYE_FIELD_COUNT * stride, 0.0f);
+        flags.assign(n, 0);
+        for (int i = 0; i < n; i++) SetBase(i, base);
+    }
+
+    // Appends a layer on top of the others, weight 0 for every face; returns its index
+    int AddLayer(EyeBlendMode mode, uint32_t mask) {
+        float neutral = (mode == EYE_BLEND_MULTIPLY) ? 1.0f : 0.0f;
+        layers.push_back(Layer{ mode, mask & EYE_FIELDS_ALL, std::vector<float>((size_t)EYE_FIELD_COUNT * stride, neutral), std::vector<float>(stride, 0.0f) });
+        return (int)layers.size() - 1;
+    }
+
+    int FaceCount() const { return count; }
+    int LayerCount() const { return (int)layers.size(); }
+
+    // Base expression, flags included; the flags pass through the layers untouched
+    void SetBase(int face, const EyeConfig &cfg) {
+        SetValues(0, face, cfg);
+        flags[face] = (uint8_t)(cfg.Inverse_Radius_Top | cfg.Inverse_Radius_Bottom << 1 | cfg.Inverse_Offset_Top << 2 | cfg.Inverse_Offset_Bottom << 3);
+    }
+
+    // Layer values for one face from a config; only the layer's masked fields matter
+    void SetValues(int layer, int face, const EyeConfig &cfg) {
+        const float *src = &cfg.OffsetX;
+        for (int k = 0; k < EYE_FIELD_COUNT; k++) layers[layer].values[(size_t)k * stride + face] = src[k];
+    }
+
+    void SetValue(int layer, EyeField field, int face, float value) { layers[layer].values[(size_t)field * stride + face] = value; }
+    void SetWeight(int layer, int face, float weight) { layers[layer].weights[face] = weight; }
+
+    // Whole columns, for systems that drive every face at once
+    float *Values(int layer, EyeField field) { return layers[layer].values.data() + (size_t)field * stride; }
+    float *Weights(int layer) { return layers[layer].weights.data(); }
+
+    // EyeBlendTree::Evaluate: Final config of every face, out[0 .. FaceCount)
+    void Evaluate(EyeConfig *out, SimdLevel level = DetectSimdLevel()) {
+        view.resize(layers.size());
+        for (size_t l = 0; l < layers.size(); l++) {
+            view[l] = EyeBlendLayerData{ layers[l].mode, layers[l].mask, layers[l].values.data(), layers[l].weights.data() };
+        }
+
+        int done = 0;
+#if FACE_SIMD_X86
+        if (level >= SIMD_AVX2) done = EyeBlendAVX2(view.data(), (int)view.size(), stride, out, count);
+        else if (level >= SIMD_SSE2) done = EyeBlendSSE2(view.data(), (int)view.size(), stride, out, count);
+#else
+        (void)level;
+#endif
+        EyeBlendScalar(view.data(), (int)view.size(), stride, out, done, count);
+
+        for (int i = 0; i < count; i++) {
+            out[i].Inverse_Radius_Top = flags[i] & 1;
+            out[i].Inverse_Radius_Bottom = (flags[i] >> 1) & 1;
+            out[i].Inverse_Offset_Top = (flags[i] >> 2) & 1;
+            out[i].Inverse_Offset_Bottom = (flags[i] >> 3) & 1;
+        }
+    }
+
+private:
+    struct Layer {
+        EyeBlendMode mode;
+        uint32_t mask;
+        std::vector<float> values;  // EYE_FIELD_COUNT columns of `stride` faces
+        std::vector<float> weights; // `stride` faces
+    };
+
+    int count = 0;
+    int stride = 0; // faces rounded up to 8, so every column starts a whole vector in
+    std::vector<Layer> layers;
+    std::vector<uint8_t> flags;
+    std::vector<EyeBlendLayerData> view;
+};
@@ -0,0 +1,245 @@
+#pragma once
+#include "eye_config.h"
+#include "eye_transition.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define EYE_CLIP_MMAP 1
+#else
+#define EYE_CLIP_MMAP 0
+#endif
+
+// --- Eye clip files ---
+// Keyframed EyeConfig animation, one track per eye, laid out to be used in place:
+//   EyeClipHeader
+//   EyeClipTrack[trackCount]
+//   per track: float times[keyCount] (ascending), then EyeClipKey keys[keyCount]
+// Times sit in their own array so the seek's binary search touches only them.
+// All fields are little endian and 4-byte aligned; offsets are from the file start.
+#define EYE_CLIP_MAGIC 0x43455945u // "EYEC"
+#define EYE_CLIP_VERSION 1
+
+struct EyeClipHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t trackCount;
+    float duration; // last key time over all tracks
+};
+
+struct EyeClipTrack {
+    uint32_t keyCount;
+    uint32_t timesOffset;
+    uint32_t keysOffset;
+};
+
+struct EyeClipKey {
+    float shape[8];  // EyeConfig OffsetX .. Radius_Bottom
+    uint8_t flags;   // EyeConfig Inverse_* bits: radius top, radius bottom, offset top, offset bottom
+    uint8_t ease;    // EaseType towards the next key
+    uint8_t pad[2];
+};
+
+static_assert(sizeof(EyeClipHeader) == 16 && sizeof(EyeClipTrack) == 12 && sizeof(EyeClipKey) == 36, "clip structs are on-disk layout");
+
+inline EyeClipKey EyeClipKeyFrom(const EyeConfig &cfg, EaseType ease) {
+    EyeClipKey key = {};
+    memcpy(key.shape, &cfg.OffsetX, sizeof(key.shape));
+    key.flags = (uint8_t)(cfg.Inverse_Radius_Top | cfg.Inverse_Radius_Bottom << 1 | cfg.Inverse_Offset_Top << 2 | cfg.Inverse_Offset_Bottom << 3);
+    key.ease = (uint8_t)ease;
+    return key;
+}
+
+inline void EyeClipKeyTo(const EyeClipKey &key, EyeConfig &cfg) {
+    memcpy(&cfg.OffsetX, key.shape, sizeof(key.shape));
+    cfg.Inverse_Radius_Top = key.flags & 1;
+    cfg.Inverse_Radius_Bottom = (key.flags >> 1) & 1;
+    cfg.Inverse_Offset_Top = (key.flags >> 2) & 1;
+    cfg.Inverse_Offset_Bottom = (key.flags >> 3) & 1;
+}
+
+// --- EyeClipView ---
+// A validated clip image in memory (mapped file or buffer); never copies or allocates
+class EyeClipView {
+public:
+    // Checks every offset against the buffer once, so Evaluate can trust them
+    bool Attach(const void *data, size_t size) {
+        base = nullptr;
+        const uint8_t *bytes = (const uint8_t *)data;
+        if (!data || size < sizeof(EyeClipHeader) || ((uintptr_t)data & 3)) return false;
+        const EyeClipHeader *h = (const EyeClipHeader *)bytes;
+        if (h->magic != EYE_CLIP_MAGIC || h->version != EYE_CLIP_VERSION || h->trackCount == 0) return false;
+        if (sizeof(EyeClipHeader) + (uint64_t)h->trackCount * sizeof(EyeClipTrack) > size) return false;
+
+        const EyeClipTrack *t = (const EyeClipTrack *)(bytes + sizeof(EyeClipHeader));
+        for (uint32_t i = 0; i < h->trackCount; i++) {
+            if (t[i].keyCount == 0 || (t[i].timesOffset & 3) || (t[i].keysOffset & 3)) return false;
+            if (t[i].timesOffset + (uint64_t)t[i].keyCount * sizeof(float) > size) return false;
+            if (t[i].keysOffset + (uint64_t)t[i].keyCount * sizeof(EyeClipKey) > size) return false;
+        }
+        base = bytes;
+        return true;
+    }
+
+    bool Valid() const { return base != nullptr; }
+    int TrackCount() const { return (int)Header()->trackCount; }
+    float Duration() const { return Header()->duration; }
+
+    // EyeClipView::Evaluate: Pose of one track at `time` (clamped to its keys); O(log keys).
+    // An out-of-range track leaves `out` untouched
+    void Evaluate(int track, float time, EyeConfig &out) const {
+        if (track < 0 || track >= TrackCount()) return;
+        const EyeClipTrack &t = Tracks()[track];
+        const float *times = (const float *)(base + t.timesOffset);
+        const EyeClipKey *keys = (const EyeClipKey *)(base + t.keysOffset);
+        int n = (int)t.keyCount;
+
+        // First key strictly after `time`
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (times[mid] <= time) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo == 0 || lo == n) {
+            EyeClipKeyTo(keys[lo == 0 ? 0 : n - 1], out);
+            return;
+        }
+
+        const EyeClipKey &a = keys[lo - 1], &b = keys[lo];
+        float span = times[lo] - times[lo - 1];
+        float u = EaseApply((EaseType)a.ease, span > 0.0f ? (time - times[lo - 1]) / span : 1.0f);
+        EyeClipKeyTo(u < 0.5f ? a : b, out); // flags
+        for (int k = 0; k < 8; k++) (&out.OffsetX)[k] = a.shape[k] + (b.shape[k] - a.shape[k]) * u;
+    }
+
+private:
+    const EyeClipHeader *Header() const { return (const EyeClipHeader *)base; }
+    const EyeClipTrack *Tracks() const { return (const EyeClipTrack *)(base + sizeof(EyeClipHeader)); }
+
+    const uint8_t *base = nullptr;
+};
+
+// --- EyeClipFile ---
+// Maps a clip file read-only; pages load on first touch, so opening costs the same for
+// a 1 KB clip and a 10 MB one
+class EyeClipFile {
+public:
+    EyeClipFile() {}
+    ~EyeClipFile() { Close(); }
+    EyeClipFile(const EyeClipFile &) = delete;
+    EyeClipFile &operator=(const EyeClipFile &) = delete;
+
+    bool Open(const char *path) {
+        Close();
+#if EYE_CLIP_MMAP
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return false;
+        }
+        void *mapped = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED) return false;
+        mapping = mapped;
+        mappingSize = (size_t)st.st_size;
+        if (!view.Attach(mapping, mappingSize)) Close();
+#else
+        // No mmap: read the file once into a word-aligned buffer
+        FILE *f = fopen(path, "rb");
+        if (!f) return false;
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        if (size > 0) {
+            buffer.resize(((size_t)size + 3) / 4);
+            if (fread(buffer.data(), 1, (size_t)size, f) == (size_t)size) view.Attach(buffer.data(), (size_t)size);
+        }
+        fclose(f);
+#endif
+        return view.Valid();
+    }
+
+    void Close() {
+        view = EyeClipView();
+#if EYE_CLIP_MMAP
+        if (mapping) munmap(mapping, mappingSize);
+        mapping = nullptr;
+        mappingSize = 0;
+#else
+        buffer.clear();
+#endif
+    }
+
+    const EyeClipView &View() const { return view; }
+
+private:
+    EyeClipView view;
+#if EYE_CLIP_MMAP
+    void *mapping = nullptr;
+    size_t mappingSize = 0;
+#else
+    std::vector<uint32_t> buffer;
+#endif
+};
+
+// --- Writing ---
+// Authoring-side track: keys must be in ascending time order
+struct EyeClipTrackData {
+    std::vector<float> times;
+    std::vector<EyeConfig> keys;
+    std::vector<EaseType> ease; // towards the next key; missing entries are linear
+
+    void Add(float time, const EyeConfig &cfg, EaseType easeType = EASE_LINEAR) {
+        times.push_back(time);
+        keys.push_back(cfg);
+        ease.push_back(easeType);
+    }
+};
+
+// EyeClipSerialize: File image for the given tracks (empty if there are no tracks or a track has no keys)
+inline std::vector<uint8_t> EyeClipSerialize(const std::vector<EyeClipTrackData> &tracks) {
+    if (tracks.empty()) return {};
+    size_t size = sizeof(EyeClipHeader) + tracks.size() * sizeof(EyeClipTrack);
+    for (const EyeClipTrackData &t : tracks) {
+        if (t.times.empty() || t.times.size() != t.keys.size()) return {};
+        size += t.times.size() * (sizeof(float) + sizeof(EyeClipKey));
+    }
+
+    std::vector<uint8_t> image(size, 0);
+    EyeClipHeader header = { EYE_CLIP_MAGIC, EYE_CLIP_VERSION, (uint32_t)tracks.size(), 0.0f };
+    size_t pos = sizeof(EyeClipHeader) + tracks.size() * sizeof(EyeClipTrack);
+    for (size_t i = 0; i < tracks.size(); i++) {
+        const EyeClipTrackData &t = tracks[i];
+        uint32_t count = (uint32_t)t.times.size();
+        EyeClipTrack entry = { count, (uint32_t)pos, (uint32_t)(pos + count * sizeof(float)) };
+        memcpy(&image[sizeof(EyeClipHeader) + i * sizeof(EyeClipTrack)], &entry, sizeof(entry));
+
+        memcpy(&image[entry.timesOffset], t.times.data(), count * sizeof(float));
+        for (uint32_t k = 0; k < count; k++) {
+            EyeClipKey key = EyeClipKeyFrom(t.keys[k], k < t.ease.size() ? t.ease[k] : EASE_LINEAR);
+            memcpy(&image[entry.keysOffset + k * sizeof(EyeClipKey)], &key, sizeof(key));
+        }
+        pos = entry.keysOffset + count * sizeof(EyeClipKey);
+        if (t.times.back() > header.duration) header.duration = t.times.back();
+    }
+    memcpy(image.data(), &header, sizeof(header));
+    return image;
+}
+
+inline bool EyeClipWrite(const char *path, const std::vector<EyeClipTrackData> &tracks) {
+    std::vector<uint8_t> image = EyeClipSerialize(tracks);
+    if (image.empty()) return false;
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(image.data(), 1, image.size(), f) == image.size();
+    return (fclose(f) == 0) && ok;
+}
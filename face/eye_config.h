@@ -0,0 +1,28 @@
+#pragma once
+
+// --- Eye configuration ---
+struct EyeConfig {
+    float OffsetX;
+    float OffsetY;
+    float Height;
+    float Width;
+    float Slope_Top;
+    float Slope_Bottom;
+    float Radius_Top;
+    float Radius_Bottom;
+    bool Inverse_Radius_Top;
+    bool Inverse_Radius_Bottom;
+    bool Inverse_Offset_Top;
+    bool Inverse_Offset_Bottom;
+};
+
+// Presets
+static const EyeConfig Preset_Neutral = {0, 0, 40, 50, 0, 0, 10, 10, 0, 0, 0, 0};
+static const EyeConfig Preset_Awe = {2, 0, 35, 45, -0.1f, 0.1f, 12, 12, 0, 0, 0, 0};
+static const EyeConfig Preset_Happy = {0, -3, 35, 50, -0.2f, 0.2f, 10, 8, 0, 0, 0, 0};
+static const EyeConfig Preset_Sad = {0, 4, 30, 48, -0.3f, 0, 8, 12, 0, 0, 1, 0};
+static const EyeConfig Preset_Angry = {0, 2, 28, 50, 0.35f, 0, 4, 10, 0, 0, 1, 0};
+static const EyeConfig Preset_Surprised = {0, -4, 50, 44, 0, 0, 18, 18, 0, 0, 0, 0};
+static const EyeConfig Preset_Sleepy = {0, 6, 12, 50, 0, 0, 5, 6, 0, 0, 0, 0};
+static const EyeConfig Preset_Excited = {0, -5, 38, 52, -0.15f, 0.3f, 14, 6, 0, 0, 0, 0};
+static const EyeConfig Preset_Content = {0, 0, 24, 50, 0, 0.25f, 10, 6, 0, 0, 0, 0};
@@ -0,0 +1,279 @@
+#pragma once
+#include "eye_clip.h"
+#include "eye_config.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// --- Curve-compressed clips ---
+// Dense per-frame EyeConfig tracks reduced to piecewise-linear curves. Each float field
+// keeps only the keys needed to stay within its tolerance; values are 16-bit steps of
+// the field's range and key times 16-bit frame deltas, 4 bytes per key. The flags are a
+// ninth, stepped channel with a key wherever they change.
+// Seeking never searches: for every EYE_CURVE_BUCKET_FRAMES frames a bucket records the
+// key in effect at its start, and sampling walks forward from there, at most one
+// bucket's worth of keys, however long the clip.
+#define EYE_CURVE_MAGIC 0x51455945u // "EYEQ"
+#define EYE_CURVE_VERSION 1
+#define EYE_CURVE_CHANNELS 9        // eight floats + flags
+#define EYE_CURVE_BUCKET_FRAMES 128
+
+struct EyeCurveKey {
+    uint16_t frameDelta; // frames since the previous key (0 for the first)
+    uint16_t value;      // base + value * scale, or the flag bits
+};
+
+struct EyeCurveBucket {
+    uint32_t key;   // last key at or before the bucket's first frame, within the channel
+    uint32_t frame; // that key's frame
+};
+
+struct EyeCurveChannel {
+    float base, scale;
+    uint32_t firstKey, keyCount;
+    uint32_t firstBucket;
+};
+
+struct EyeCurveHeader {
+    uint32_t magic;
+    uint32_t version;
+    float fps;
+    uint32_t frameCount;
+    uint32_t bucketCount; // per channel
+    uint32_t keyCount;    // all channels
+};
+
+static_assert(sizeof(EyeCurveKey) == 4 && sizeof(EyeCurveBucket) == 8 && sizeof(EyeCurveChannel) == 20 && sizeof(EyeCurveHeader) == 24, "curve structs are on-disk layout");
+
+// Largest error allowed per field, in the field's own units. Offsets and sizes are
+// pixels; slopes scale with Height, so theirs is tighter.
+struct EyeCurveOptions {
+    float tolerance[8] = { 0.05f, 0.05f, 0.05f, 0.05f, 0.001f, 0.001f, 0.05f, 0.05f };
+};
+
+inline uint8_t EyeCurveFlags(const EyeConfig &cfg) {
+    return (uint8_t)(cfg.Inverse_Radius_Top | cfg.Inverse_Radius_Bottom << 1 | cfg.Inverse_Offset_Top << 2 | cfg.Inverse_Offset_Bottom << 3);
+}
+
+// --- EyeCurveClip ---
+class EyeCurveClip {
+public:
+    float Fps() const { return header.fps; }
+    int FrameCount() const { return (int)header.frameCount; }
+    float Duration() const { return header.frameCount > 1 ? (header.frameCount - 1) / header.fps : 0.0f; }
+    int KeyCount(int channel) const { return (int)channels[channel].keyCount; }
+    bool Valid() const { return header.frameCount > 0; }
+
+    // Serialized size
+    size_t Bytes() const {
+        return sizeof(EyeCurveHeader) + sizeof(channels) + buckets.size() * sizeof(EyeCurveBucket) + keys.size() * sizeof(EyeCurveKey);
+    }
+
+    // EyeCurveClip::Sample: Pose at `time` seconds (clamped); cost doesn't grow with the clip.
+    // An empty clip (never compressed or loaded) leaves `out` untouched
+    void Sample(float time, EyeConfig &out) const {
+        if (!Valid()) return;
+        float f = time * header.fps;
+        if (f < 0.0f) f = 0.0f;
+        if (f > header.frameCount - 1) f = (float)(header.frameCount - 1);
+        SampleFrame((uint32_t)f, f - (uint32_t)f, out);
+    }
+
+    // Pose `fraction` of the way from `frame` to the next one. Past an hour at 60 fps a
+    // float time resolves only ~1/64 of a frame; this form stays exact.
+    void SampleFrame(uint32_t frame, float fraction, EyeConfig &out) const {
+        if (!Valid()) return;
+        if (frame >= header.frameCount - 1) {
+            frame = header.frameCount - 1;
+            fraction = 0.0f;
+        }
+        uint32_t bucket = frame / EYE_CURVE_BUCKET_FRAMES;
+
+        for (int c = 0; c < EYE_CURVE_CHANNELS; c++) {
+            const EyeCurveChannel &ch = channels[c];
+            const EyeCurveKey *k = keys.data() + ch.firstKey;
+            const EyeCurveBucket &start = buckets[ch.firstBucket + bucket];
+            uint32_t i = start.key, keyFrame = start.frame;
+            while (i + 1 < ch.keyCount && keyFrame + k[i + 1].frameDelta <= frame) keyFrame += k[++i].frameDelta;
+
+            if (c == EYE_CURVE_CHANNELS - 1) {
+                out.Inverse_Radius_Top = k[i].value & 1;
+                out.Inverse_Radius_Bottom = (k[i].value >> 1) & 1;
+                out.Inverse_Offset_Top = (k[i].value >> 2) & 1;
+                out.Inverse_Offset_Bottom = (k[i].value >> 3) & 1;
+                break;
+            }
+            float a = ch.base + k[i].value * ch.scale;
+            if (i + 1 < ch.keyCount) {
+                float b = ch.base + k[i + 1].value * ch.scale;
+                a += (b - a) * (((frame - keyFrame) + fraction) / k[i + 1].frameDelta);
+            }
+            (&out.OffsetX)[c] = a;
+        }
+    }
+
+    // --- Compression ---
+    // EyeCurveClip::Compress: Fits `count` frames sampled at `fps`
+    bool Compress(const EyeConfig *frames, int count, float fps, const EyeCurveOptions &options = EyeCurveOptions()) {
+        header = EyeCurveHeader{ EYE_CURVE_MAGIC, EYE_CURVE_VERSION, fps, 0, 0, 0 };
+        keys.clear();
+        buckets.clear();
+        if (count <= 0 || fps <= 0.0f) return false;
+        header.frameCount = (uint32_t)count;
+        header.bucketCount = (count + EYE_CURVE_BUCKET_FRAMES - 1) / EYE_CURVE_BUCKET_FRAMES;
+
+        std::vector<float> values(count);
+        std::vector<uint32_t> keyFrames;
+        for (int c = 0; c < EYE_CURVE_CHANNELS; c++) {
+            EyeCurveChannel &ch = channels[c];
+            ch.firstKey = (uint32_t)keys.size();
+            ch.firstBucket = (uint32_t)buckets.size();
+            keyFrames.clear();
+
+            if (c < 8) {
+                for (int i = 0; i < count; i++) values[i] = (&frames[i].OffsetX)[c];
+                FitChannel(values.data(), count, options.tolerance[c], ch, keyFrames);
+            } else {
+                ch.base = 0.0f;
+                ch.scale = 1.0f;
+                for (int i = 0; i < count; i++) {
+                    uint8_t flags = EyeCurveFlags(frames[i]);
+                    if (i == 0 || flags != EyeCurveFlags(frames[i - 1]) || i - keyFrames.back() == 0xFFFF) {
+                        keyFrames.push_back(i);
+                        keys.push_back(EyeCurveKey{ 0, flags });
+                    }
+                }
+            }
+
+            // Frame deltas and the bucket index
+            ch.keyCount = (uint32_t)keyFrames.size();
+            EyeCurveKey *k = keys.data() + ch.firstKey;
+            for (uint32_t i = 0; i < ch.keyCount; i++) k[i].frameDelta = (uint16_t)(i ? keyFrames[i] - keyFrames[i - 1] : 0);
+            uint32_t key = 0;
+            for (uint32_t b = 0; b < header.bucketCount; b++) {
+                uint32_t first = b * EYE_CURVE_BUCKET_FRAMES;
+                while (key + 1 < ch.keyCount && keyFrames[key + 1] <= first) key++;
+                buckets.push_back(EyeCurveBucket{ key, keyFrames[key] });
+            }
+        }
+        header.keyCount = (uint32_t)keys.size();
+        return true;
+    }
+
+    // --- Serialization ---
+    // Header, channels, buckets, keys; little endian, no padding
+    std::vector<uint8_t> Serialize() const {
+        std::vector<uint8_t> image(Bytes());
+        uint8_t *p = image.data();
+        memcpy(p, &header, sizeof(header));
+        p += sizeof(header);
+        memcpy(p, channels, sizeof(channels));
+        p += sizeof(channels);
+        memcpy(p, buckets.data(), buckets.size() * sizeof(EyeCurveBucket));
+        p += buckets.size() * sizeof(EyeCurveBucket);
+        memcpy(p, keys.data(), keys.size() * sizeof(EyeCurveKey));
+        return image;
+    }
+
+    // Validates every index before taking the data, so Sample can trust it
+    bool Load(const void *data, size_t size) {
+        *this = EyeCurveClip();
+        const uint8_t *p = (const uint8_t *)data;
+        if (!data || size < sizeof(EyeCurveHeader) + sizeof(channels)) return false;
+        EyeCurveHeader h;
+        memcpy(&h, p, sizeof(h));
+        if (h.magic != EYE_CURVE_MAGIC || h.version != EYE_CURVE_VERSION || h.frameCount == 0 || !(h.fps > 0.0f)) return false;
+        if (h.bucketCount != (h.frameCount + EYE_CURVE_BUCKET_FRAMES - 1) / EYE_CURVE_BUCKET_FRAMES) return false;
+        uint64_t expected = sizeof(EyeCurveHeader) + sizeof(channels) + (uint64_t)h.bucketCount * EYE_CURVE_CHANNELS * sizeof(EyeCurveBucket) + (uint64_t)h.keyCount * sizeof(EyeCurveKey);
+        if (expected != size) return false;
+
+        EyeCurveChannel ch[EYE_CURVE_CHANNELS];
+        memcpy(ch, p + sizeof(h), sizeof(ch));
+        std::vector<EyeCurveBucket> b((size_t)h.bucketCount * EYE_CURVE_CHANNELS);
+        std::vector<EyeCurveKey> k(h.keyCount);
+        memcpy(b.data(), p + sizeof(h) + sizeof(ch), b.size() * sizeof(EyeCurveBucket));
+        memcpy(k.data(), p + sizeof(h) + sizeof(ch) + b.size() * sizeof(EyeCurveBucket), k.size() * sizeof(EyeCurveKey));
+        std::vector<uint32_t> keyFrames;
+        for (int c = 0; c < EYE_CURVE_CHANNELS; c++) {
+            if (ch[c].keyCount == 0 || (uint64_t)ch[c].firstKey + ch[c].keyCount > h.keyCount) return false;
+            if ((uint64_t)ch[c].firstBucket + h.bucketCount > b.size()) return false;
+
+            // Keys after the first move forward, so the interpolation never divides by zero
+            const EyeCurveKey *ck = k.data() + ch[c].firstKey;
+            keyFrames.resize(ch[c].keyCount);
+            keyFrames[0] = 0;
+            for (uint32_t i = 1; i < ch[c].keyCount; i++) {
+                if (ck[i].frameDelta == 0) return false;
+                keyFrames[i] = keyFrames[i - 1] + ck[i].frameDelta;
+            }
+
+            // Each bucket names a key at or before its first frame, with that key's real frame
+            for (uint32_t i = 0; i < h.bucketCount; i++) {
+                const EyeCurveBucket &bucket = b[ch[c].firstBucket + i];
+                if (bucket.key >= ch[c].keyCount || bucket.frame != keyFrames[bucket.key]) return false;
+                if (bucket.frame > i * EYE_CURVE_BUCKET_FRAMES) return false;
+            }
+        }
+
+        header = h;
+        memcpy(channels, ch, sizeof(ch));
+        buckets.swap(b);
+        keys.swap(k);
+        return true;
+    }
+
+private:
+    // Greedy swing-door fit: from each key, extend the line as far as every frame in
+    // between stays within `tolerance` of it; keys hold quantized values, so the
+    // check runs against what the decoder will actually see
+    void FitChannel(const float *v, int count, float tolerance, EyeCurveChannel &ch, std::vector<uint32_t> &keyFrames) {
+        float lo = v[0], hi = v[0];
+        for (int i = 1; i < count; i++) {
+            lo = fminf(lo, v[i]);
+            hi = fmaxf(hi, v[i]);
+        }
+        ch.base = lo;
+        ch.scale = (hi - lo) / 65535.0f;
+        auto quantize = [&](float x) -> uint16_t { return ch.scale > 0.0f ? (uint16_t)fminf(roundf((x - lo) / ch.scale), 65535.0f) : 0; };
+        auto decode = [&](uint16_t q) { return ch.base + q * ch.scale; };
+
+        auto emit = [&](int frame) {
+            keyFrames.push_back(frame);
+            keys.push_back(EyeCurveKey{ 0, quantize(v[frame]) });
+        };
+
+        int start = 0;
+        emit(0);
+        float startValue = decode(keys.back().value);
+        float slopeLo = -INFINITY, slopeHi = INFINITY;
+        for (int e = 1; e < count; e++) {
+            float slope = (decode(quantize(v[e])) - startValue) / (e - start);
+            if (slope < slopeLo || slope > slopeHi || e - start > 0xFFFF) {
+                // The line can't reach e: close the segment at e - 1
+                start = e - 1;
+                emit(start);
+                startValue = decode(keys.back().value);
+                slopeLo = -INFINITY;
+                slopeHi = INFINITY;
+            }
+            // Frame e becomes an in-between point for longer segments
+            slopeLo = fmaxf(slopeLo, (v[e] - tolerance - startValue) / (e - start));
+            slopeHi = fminf(slopeHi, (v[e] + tolerance - startValue) / (e - start));
+        }
+        if (count > 1) emit(count - 1);
+    }
+
+    EyeCurveHeader header = { EYE_CURVE_MAGIC, EYE_CURVE_VERSION, 0.0f, 0, 0, 0 };
+    EyeCurveChannel channels[EYE_CURVE_CHANNELS] = {};
+    std::vector<EyeCurveBucket> buckets; // bucketCount per channel
+    std::vector<EyeCurveKey> keys;
+};
+
+// EyeCurveSampleClip: Dense frames of one keyframed clip track, ready to compress
+inline std::vector<EyeConfig> EyeCurveSampleClip(const EyeClipView &clip, int track, float fps) {
+    int count = (int)(clip.Duration() * fps) + 1;
+    std::vector<EyeConfig> frames(count);
+    for (int i = 0; i < count; i++) clip.Evaluate(track, i / fps, frames[i]);
+    return frames;
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include "eye_config.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// --- Emotion space ---
+// Continuous expressions from (valence, arousal) in [-1, 1]^2: unpleasant .. pleasant,
+// calm .. excited. Anchor presets are placed in that plane and blended offline onto a
+// regular grid by inverse-distance weighting; a lookup is then a bilinear blend of four
+// grid nodes, 8 fields x 3 lerps, with no search and no per-anchor work. Flags can't be
+// blended and come from the anchor nearest to the node nearest the query.
+struct EmotionAnchor {
+    float valence, arousal;
+    EyeConfig cfg;
+};
+
+// On the default 17 x 17 grid (steps of 1/8) every anchor sits on a node and is
+// reproduced exactly
+static const EmotionAnchor Emotion_DefaultAnchors[] = {
+    {  0.0f,    0.0f,  Preset_Neutral },
+    {  0.75f,   0.25f, Preset_Happy },
+    {  0.75f,   0.75f, Preset_Excited },
+    {  0.625f, -0.5f,  Preset_Content },
+    {  0.25f,   0.75f, Preset_Awe },
+    {  0.0f,    1.0f,  Preset_Surprised },
+    { -0.75f,   0.75f, Preset_Angry },
+    { -0.75f,  -0.5f,  Preset_Sad },
+    {  0.0f,   -1.0f,  Preset_Sleepy },
+};
+
+// Inverse-distance (power 2) blend of the anchors at one point; exact on an anchor.
+// No anchors gives a zeroed config
+inline void EmotionBlendAnchors(const EmotionAnchor *anchors, int count, float valence, float arousal, EyeConfig &out) {
+    out = EyeConfig{};
+    if (count <= 0) return;
+    float sum[8] = {}, total = 0.0f, nearest = INFINITY;
+    for (int i = 0; i < count; i++) {
+        float dv = valence - anchors[i].valence, da = arousal - anchors[i].arousal;
+        float d2 = dv * dv + da * da;
+        if (d2 < nearest) {
+            nearest = d2;
+            out = anchors[i].cfg; // flags, and the exact answer if d2 is ~0
+        }
+        if (d2 < 1e-12f) return;
+        float w = 1.0f / d2;
+        const float *f = &anchors[i].cfg.OffsetX;
+        for (int k = 0; k < 8; k++) sum[k] += w * f[k];
+        total += w;
+    }
+    if (nearest < 1e-12f) return;
+    for (int k = 0; k < 8; k++) (&out.OffsetX)[k] = sum[k] / total;
+}
+
+// --- EmotionGrid ---
+class EmotionGrid {
+public:
+    EmotionGrid() { Build(Emotion_DefaultAnchors, sizeof(Emotion_DefaultAnchors) / sizeof(Emotion_DefaultAnchors[0])); }
+
+    // Resamples the anchors onto resolution x resolution nodes
+    void Build(const EmotionAnchor *anchors, int count, int resolution = 17) {
+        res = resolution < 2 ? 2 : resolution;
+        scale = (res - 1) * 0.5f;
+        nodes.resize((size_t)res * res * 8);
+        flags.resize((size_t)res * res);
+        for (int y = 0; y < res; y++) {
+            for (int x = 0; x < res; x++) {
+                EyeConfig cfg;
+                EmotionBlendAnchors(anchors, count, x / scale - 1.0f, y / scale - 1.0f, cfg);
+                memcpy(&nodes[((size_t)y * res + x) * 8], &cfg.OffsetX, 8 * sizeof(float));
+                flags[(size_t)y * res + x] = (uint8_t)(cfg.Inverse_Radius_Top | cfg.Inverse_Radius_Bottom << 1 | cfg.Inverse_Offset_Top << 2 | cfg.Inverse_Offset_Bottom << 3);
+            }
+        }
+    }
+
+    int Resolution() const { return res; }
+
+    // EmotionGrid::Lookup: Expression at (valence, arousal), clamped to the unit square.
+    // The fields are blended into a local array first: written straight through &out.OffsetX
+    // the compiler has to assume they may alias the nodes and won't vectorize the loop
+    void Lookup(float valence, float arousal, EyeConfig &out) const {
+        Cell c = Locate(valence, arousal);
+        const float *n00 = &nodes[c.node * 8], *n01 = n00 + 8, *n10 = n00 + res * 8, *n11 = n10 + 8;
+        float o[8];
+        for (int k = 0; k < 8; k++) {
+            float top = n00[k] + (n01[k] - n00[k]) * c.fx;
+            float bottom = n10[k] + (n11[k] - n10[k]) * c.fx;
+            o[k] = top + (bottom - top) * c.fy;
+        }
+        memcpy(&out.OffsetX, o, sizeof(o));
+        SetFlags(c, out);
+    }
+
+    EyeConfig Lookup(float valence, float arousal) const {
+        EyeConfig out;
+        Lookup(valence, arousal, out);
+        return out;
+    }
+
+    // Every face of a crowd at once
+    void LookupBatch(const float *valence, const float *arousal, EyeConfig *out, int count) const {
+        for (int i = 0; i < count; i++) Lookup(valence[i], arousal[i], out[i]);
+    }
+
+private:
+    struct Cell {
+        int node;     // top-left node of the cell
+        int nearest;  // node closest to the query, for the flags
+        float fx, fy; // position inside the cell
+    };
+
+    Cell Locate(float valence, float arousal) const {
+        float x = (fminf(fmaxf(valence, -1.0f), 1.0f) + 1.0f) * scale;
+        float y = (fminf(fmaxf(arousal, -1.0f), 1.0f) + 1.0f) * scale;
+        int ix = (int)x, iy = (int)y;
+        if (ix > res - 2) ix = res - 2;
+        if (iy > res - 2) iy = res - 2;
+        Cell c;
+        c.fx = x - ix;
+        c.fy = y - iy;
+        c.node = iy * res + ix;
+        c.nearest = c.node + (c.fy >= 0.5f ? res : 0) + (c.fx >= 0.5f ? 1 : 0);
+        return c;
+    }
+
+    void SetFlags(const Cell &c, EyeConfig &out) const {
+        uint8_t f = flags[c.nearest];
+        out.Inverse_Radius_Top = f & 1;
+        out.Inverse_Radius_Bottom = (f >> 1) & 1;
+        out.Inverse_Offset_Top = (f >> 2) & 1;
+        out.Inverse_Offset_Bottom = (f >> 3) & 1;
+    }
+
+    int res = 2;
+    float scale = 0.5f;
+    std::vector<float> nodes;    // res * res nodes of 8 floats, row-major, arousal rows
+    std::vector<uint8_t> flags;  // per node
+};
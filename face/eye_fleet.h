@@ -0,0 +1,162 @@
+#pragma once
+#include "arc_lod.h"
+#include "eye_batch.h"
+#include "eye_mesh.h"
+#include "raylib_types.h"
+#include <math.h>
+#include <vector>
+
+// --- Fleet dashboard geometry ---
+// Every face of a fleet as one flat RL_TRIANGLES vertex list, so a whole wall of faces
+// goes out in a handful of rlgl batches instead of ~20 raylib calls per face. Outlines
+// come from EyeBatchGenerate, EYE_FLEET_CHUNK faces at a time so the vertex-major
+// scratch stays in cache, and each eye is filled as a fan around its centre (the
+// outline is star-shaped around it, as in TessellateSlopedRoundedRectangle).
+// All faces share one segment count, so every face takes the same number of vertices
+// and face i starts at i * verticesPerFace.
+#define EYE_FLEET_CHUNK 256
+
+// Faces in a grid of cells; eyes are drawn as EyeDrawer::DrawPair lays them out,
+// scaled from the design size (faceWidth x faceHeight) down to the cell
+struct EyeFleetLayout {
+    float x = 0.0f, y = 0.0f;          // top-left of the grid
+    float cellWidth = 250.0f, cellHeight = 125.0f;
+    int columns = 1;
+    float spacing = 75.0f;             // eye centres at face centre -+ spacing, design units
+    float faceWidth = 250.0f, faceHeight = 125.0f;
+
+    float Scale() const { return fminf(cellWidth / faceWidth, cellHeight / faceHeight); }
+    Vector2 FaceCenter(int i) const {
+        return Vector2{ x + (i % columns + 0.5f) * cellWidth, y + (i / columns + 0.5f) * cellHeight };
+    }
+};
+
+// EyeFleetGrid: Largest square-ish cells that fit `count` faces into width x height
+inline EyeFleetLayout EyeFleetGrid(int count, float width, float height) {
+    EyeFleetLayout layout;
+    float aspect = layout.faceWidth / layout.faceHeight;
+    if (count < 1) count = 1;
+    // Cells of the face aspect; fewest columns whose rows still fit the height
+    int columns = (int)sqrtf(count * width / (aspect * height));
+    if (columns < 1) columns = 1;
+    while (columns < count && (count + columns - 1) / columns * (width / columns / aspect) > height) columns++;
+    layout.columns = columns;
+    layout.cellWidth = width / columns;
+    layout.cellHeight = layout.cellWidth / aspect;
+    return layout;
+}
+
+// EyeFleetTransformed: The layout as a 2D camera without rotation shows it,
+// screen = world * zoom + origin
+inline EyeFleetLayout EyeFleetTransformed(const EyeFleetLayout &layout, float originX, float originY, float zoom) {
+    EyeFleetLayout out = layout;
+    out.x = layout.x * zoom + originX;
+    out.y = layout.y * zoom + originY;
+    out.cellWidth *= zoom;
+    out.cellHeight *= zoom;
+    return out;
+}
+
+struct EyeFleetMesh {
+    int count = 0;           // faces
+    int segments = 0;        // arc segments per corner
+    int verticesPerFace = 0; // both eyes, 3 per triangle
+    std::vector<Vector2> vertices;
+
+    const Vector2 *Face(int i) const { return vertices.data() + (size_t)i * verticesPerFace; }
+};
+
+// Per-thread working set for EyeFleetBuildRange
+struct EyeFleetScratch {
+    EyeBatch batch;
+    EyeBatchVertices outline;
+};
+
+// Eye config scaled into screen units; slopes are ratios and stay as they are
+inline EyeConfig EyeFleetScaled(const EyeConfig &cfg, float s) {
+    EyeConfig out = cfg;
+    out.OffsetX *= s;    out.OffsetY *= s;
+    out.Height *= s;     out.Width *= s;
+    out.Radius_Top *= s; out.Radius_Bottom *= s;
+    return out;
+}
+
+// EyeFleetPrepare: Sizes the mesh for `count` faces whose corner radii stay at or below
+// maxRadius (design units) and picks the shared segment count for that radius on screen
+inline void EyeFleetPrepare(int count, float maxRadius, const EyeFleetLayout &layout, EyeFleetMesh &mesh) {
+    int segments = ArcSegmentCount(maxRadius * layout.Scale());
+    if (segments > ARC_TABLE_MAX_SEGMENTS) segments = ARC_TABLE_MAX_SEGMENTS;
+
+    mesh.count = count;
+    mesh.segments = segments;
+    mesh.verticesPerFace = 2 * 4 * (segments + 1) * 3;
+    mesh.vertices.resize((size_t)count * mesh.verticesPerFace);
+}
+
+// Same, with the bound taken from the configs themselves
+inline void EyeFleetPrepare(const EyeConfig *cfgs, int count, const EyeFleetLayout &layout, EyeFleetMesh &mesh) {
+    float maxRadius = 0.0f;
+    for (int i = 0; i < count; i++) maxRadius = fmaxf(maxRadius, fmaxf(cfgs[i].Radius_Top, cfgs[i].Radius_Bottom));
+    EyeFleetPrepare(count, maxRadius, layout, mesh);
+}
+
+// EyeFleetBuildList: Triangles of mesh faces [begin, end) for a subset of the fleet:
+// mesh face k is cfgs[k] drawn in the cell of face ids[k] (every face when ids is null).
+// Ranges can be built in any order or in parallel, each with its own scratch
+inline void EyeFleetBuildList(const EyeConfig *cfgs, const int *ids, const EyeFleetLayout &layout, EyeFleetMesh &mesh, int begin, int end,
+                              EyeFleetScratch &scratch, SimdLevel level = DetectSimdLevel()) {
+    float s = layout.Scale();
+    float spacing = layout.spacing * s;
+    for (int first = begin; first < end; first += EYE_FLEET_CHUNK) {
+        int n = end - first < EYE_FLEET_CHUNK ? end - first : EYE_FLEET_CHUNK;
+
+        // Left eyes in [0, n), right eyes in [n, 2n)
+        scratch.batch.Resize(2 * n);
+        for (int i = 0; i < n; i++) {
+            const EyeConfig &cfg = cfgs[first + i];
+            Vector2 c = layout.FaceCenter(ids ? ids[first + i] : first + i);
+            scratch.batch.Set(i, c.x - spacing, c.y, EyeFleetScaled(cfg, s));
+            scratch.batch.Set(n + i, c.x + spacing, c.y, EyeFleetScaled(EyeConfigRight(cfg), s));
+        }
+        EyeBatchGenerate(scratch.batch, mesh.segments, scratch.outline, level);
+
+        const EyeBatchVertices &o = scratch.outline;
+        int eyes = o.count, vertices = o.verticesPerEye;
+        for (int e = 0; e < eyes; e++) {
+            int face = first + (e < n ? e : e - n);
+            Vector2 *out = mesh.vertices.data() + (size_t)face * mesh.verticesPerFace + (e < n ? 0 : vertices * 3);
+            const float *x = o.x.data() + e, *y = o.y.data() + e;
+
+            Vector2 center = { 0.0f, 0.0f };
+            for (int v = 0; v < vertices; v++) {
+                center.x += x[v * eyes];
+                center.y += y[v * eyes];
+            }
+            center.x /= vertices;
+            center.y /= vertices;
+
+            // Outline is counter-clockwise on screen, so (centre, v, v + 1) faces front
+            Vector2 prev = { x[(vertices - 1) * eyes], y[(vertices - 1) * eyes] };
+            for (int v = 0; v < vertices; v++) {
+                Vector2 cur = { x[v * eyes], y[v * eyes] };
+                *out++ = center;
+                *out++ = prev;
+                *out++ = cur;
+                prev = cur;
+            }
+        }
+    }
+}
+
+// EyeFleetBuildRange: Triangles of faces [begin, end) of the whole fleet
+inline void EyeFleetBuildRange(const EyeConfig *cfgs, const EyeFleetLayout &layout, EyeFleetMesh &mesh, int begin, int end,
+                               EyeFleetScratch &scratch, SimdLevel level = DetectSimdLevel()) {
+    EyeFleetBuildList(cfgs, nullptr, layout, mesh, begin, end, scratch, level);
+}
+
+// EyeFleetBuild: Triangles of every face, single threaded
+inline void EyeFleetBuild(const EyeConfig *cfgs, int count, const EyeFleetLayout &layout, EyeFleetMesh &mesh,
+                          EyeFleetScratch &scratch, SimdLevel level = DetectSimdLevel()) {
+    EyeFleetPrepare(cfgs, count, layout, mesh);
+    EyeFleetBuildRange(cfgs, layout, mesh, 0, count, scratch, level);
+}
@@ -0,0 +1,173 @@
+#pragma once
+#include "eye_transition.h"
+#include "timer_wheel.h"
+#include <vector>
+
+// --- Idle behaviour ---
+// Blinks, squints and glances for many faces, scheduled on a TimerWheel in milliseconds.
+// Each face keeps its base expression plus the modifiers currently applied; every event
+// changes a modifier and starts a transition to the recomposed pose. Between events a
+// face costs nothing: only faces with a running transition are touched per frame.
+enum EyeIdleEvent {
+    IDLE_BLINK = 0,   // close
+    IDLE_BLINK_OPEN,
+    IDLE_SQUINT,
+    IDLE_SQUINT_END,
+    IDLE_GLANCE,
+    IDLE_GLANCE_BACK,
+    IDLE_EVENT_COUNT
+};
+
+// Intervals in milliseconds, drawn uniformly from [min, max]
+struct EyeIdleTiming {
+    uint32_t blinkMin = 2000, blinkMax = 6000;
+    uint32_t blinkClose = 60, blinkShut = 50, blinkOpen = 110;
+    uint32_t squintMin = 8000, squintMax = 20000;
+    uint32_t squintHoldMin = 600, squintHoldMax = 1500;
+    uint32_t glanceMin = 3000, glanceMax = 9000;
+    uint32_t glanceHoldMin = 400, glanceHoldMax = 1200;
+    uint32_t glanceMove = 120;
+    float glanceRangeX = 12.0f, glanceRangeY = 6.0f;
+    float squintHeight = 0.6f; // height scale while squinting
+};
+
+class EyeIdleScheduler {
+public:
+    EyeIdleTiming timing;
+
+    // n faces at `base`, first events spread over their intervals so faces don't blink in sync
+    void Resize(int n, const EyeConfig &base) {
+        faces.assign(n, Face());
+        pose.assign(n, base);
+        active.clear();
+        wheel = TimerWheel();
+        for (int i = 0; i < n; i++) {
+            faces[i].base = base;
+            faces[i].transition.Set(base);
+            wheel.Schedule(Random(0, timing.blinkMax), Payload(i, IDLE_BLINK));
+            wheel.Schedule(Random(timing.squintMin, timing.squintMax), Payload(i, IDLE_SQUINT));
+            wheel.Schedule(Random(0, timing.glanceMax), Payload(i, IDLE_GLANCE));
+        }
+    }
+
+    int FaceCount() const { return (int)faces.size(); }
+    const EyeConfig &Pose(int face) const { return pose[face]; }
+    int Animating() const { return (int)active.size(); }
+    int PendingEvents() const { return wheel.Pending(); }
+
+    // New base expression for one face; idle modifiers stay on top of it
+    void SetExpression(int face, const EyeConfig &cfg, float seconds, EaseType ease) {
+        faces[face].base = cfg;
+        Retarget(face, seconds, ease);
+    }
+
+    // EyeIdleScheduler::Update: Fires due events, then advances running transitions
+    void Update(float dt) {
+        clockMs += dt * 1000.0f;
+        uint32_t ticks = (uint32_t)clockMs;
+        clockMs -= ticks;
+        wheel.Advance(ticks, [this](uint32_t payload) { Fire(payload >> 3, (EyeIdleEvent)(payload & 7)); });
+
+        for (size_t k = 0; k < active.size();) {
+            int i = active[k];
+            Face &face = faces[i];
+            pose[i] = face.transition.Update(dt);
+            if (face.transition.Done()) {
+                face.animating = false;
+                active[k] = active.back();
+                active.pop_back();
+            } else {
+                k++;
+            }
+        }
+    }
+
+private:
+    struct Face {
+        EyeConfig base;
+        EyeTransition transition;
+        bool blinking = false, squinting = false, animating = false;
+        float glanceX = 0.0f, glanceY = 0.0f;
+    };
+
+    static uint32_t Payload(int face, EyeIdleEvent event) { return (uint32_t)face << 3 | event; }
+
+    uint32_t Random(uint32_t lo, uint32_t hi) {
+        // xorshift32
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        return lo + rng % (hi - lo + 1);
+    }
+
+    float RandomSigned(float range) { return range * ((float)Random(0, 2000) / 1000.0f - 1.0f); }
+
+    // Base expression with the active modifiers applied
+    EyeConfig Compose(const Face &face) const {
+        EyeConfig cfg = face.base;
+        cfg.OffsetX += face.glanceX;
+        cfg.OffsetY += face.glanceY;
+        if (face.squinting) cfg.Height *= timing.squintHeight;
+        if (face.blinking) {
+            cfg.Height = 2.0f;
+            cfg.Radius_Top = cfg.Radius_Bottom = 1.0f;
+            cfg.Slope_Top = cfg.Slope_Bottom = 0.0f;
+        }
+        return cfg;
+    }
+
+    void Retarget(int i, float seconds, EaseType ease) {
+        Face &face = faces[i];
+        face.transition.Start(Compose(face), seconds, ease);
+        if (!face.animating) {
+            face.animating = true;
+            active.push_back(i);
+        }
+    }
+
+    void Fire(int i, EyeIdleEvent event) {
+        Face &face = faces[i];
+        switch (event) {
+            case IDLE_BLINK:
+                face.blinking = true;
+                Retarget(i, timing.blinkClose / 1000.0f, EASE_IN_QUAD);
+                wheel.Schedule(timing.blinkClose + timing.blinkShut, Payload(i, IDLE_BLINK_OPEN));
+                wheel.Schedule(Random(timing.blinkMin, timing.blinkMax), Payload(i, IDLE_BLINK));
+                break;
+            case IDLE_BLINK_OPEN:
+                face.blinking = false;
+                Retarget(i, timing.blinkOpen / 1000.0f, EASE_OUT_QUAD);
+                break;
+            case IDLE_SQUINT:
+                face.squinting = true;
+                Retarget(i, 0.2f, EASE_IN_OUT_QUAD);
+                wheel.Schedule(Random(timing.squintHoldMin, timing.squintHoldMax), Payload(i, IDLE_SQUINT_END));
+                wheel.Schedule(Random(timing.squintMin, timing.squintMax), Payload(i, IDLE_SQUINT));
+                break;
+            case IDLE_SQUINT_END:
+                face.squinting = false;
+                Retarget(i, 0.25f, EASE_IN_OUT_QUAD);
+                break;
+            case IDLE_GLANCE:
+                face.glanceX = RandomSigned(timing.glanceRangeX);
+                face.glanceY = RandomSigned(timing.glanceRangeY);
+                Retarget(i, timing.glanceMove / 1000.0f, EASE_OUT_QUAD);
+                wheel.Schedule(Random(timing.glanceHoldMin, timing.glanceHoldMax), Payload(i, IDLE_GLANCE_BACK));
+                wheel.Schedule(Random(timing.glanceMin, timing.glanceMax), Payload(i, IDLE_GLANCE));
+                break;
+            case IDLE_GLANCE_BACK:
+                face.glanceX = face.glanceY = 0.0f;
+                Retarget(i, timing.glanceMove / 1000.0f, EASE_IN_OUT_QUAD);
+                break;
+            default:
+                break;
+        }
+    }
+
+    TimerWheel wheel;
+    std::vector<Face> faces;
+    std::vector<EyeConfig> pose;
+    std::vector<int> active;
+    float clockMs = 0.0f;
+    uint32_t rng = 0x9E3779B9u;
+};
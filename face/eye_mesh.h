@@ -0,0 +1,215 @@
+#pragma once
+#include "arc_lod.h"
+#include "arc_tables.h"
+#include "eye_config.h"
+#include "raylib_types.h"
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// --- EyeMesh ---
+// One eye tessellated around (0, 0): the segments EyeDrawer::Draw used to send
+// through DrawLineV/DrawTriangleLines and the triangles of its DrawCircleSector
+// corners. The eye centre is added at submit time, so both eyes share a mesh.
+struct EyeMesh {
+    EyeConfig cfg;
+    uint64_t key = 0;
+    bool valid = false;
+    std::vector<Vector2> lines;     // RL_LINES, two vertices per segment
+    std::vector<Vector2> triangles; // RL_TRIANGLES, three vertices per triangle
+};
+
+// FNV-1a over the raw bytes of every field
+inline uint64_t EyeConfigHash(const EyeConfig &cfg) {
+    const unsigned char *bytes = (const unsigned char *)&cfg;
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < sizeof(EyeConfig); i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Triangles of the filled quarter sector starting at quadrant * 90 degrees,
+// in the same winding DrawCircleSector emits
+inline void EyeMeshAddSector(std::vector<Vector2> &out, Vector2 center, float radius, int quadrant) {
+    int segments = ArcSegmentCount(radius);
+    const Vector2 *dir = QuarterArcDirections(segments);
+    for (int i = 0; i < segments; i++) {
+        out.push_back(center);
+        out.push_back(ArcTablePoint(dir, i + 1, quadrant, center, radius));
+        out.push_back(ArcTablePoint(dir, i, quadrant, center, radius));
+    }
+}
+
+// Arc centres and clamped radii of one eye, centred on (0, 0)
+struct EyeCorners {
+    Vector2 TL, TR, BL, BR;
+    float rTop, rBottom;
+};
+
+inline EyeCorners EyeCornersFor(const EyeConfig &cfg) {
+    float delta_y_top = cfg.Height * cfg.Slope_Top / 2.0f;
+    float delta_y_bottom = cfg.Height * cfg.Slope_Bottom / 2.0f;
+    float totalHeight = cfg.Height + delta_y_top - delta_y_bottom;
+
+    float rTop = cfg.Radius_Top;
+    float rBottom = cfg.Radius_Bottom;
+    if (rTop + rBottom > totalHeight - 1) {
+        float scale = (totalHeight - 1) / (rTop + rBottom);
+        rTop *= scale;
+        rBottom *= scale;
+    }
+
+    EyeCorners c;
+    c.TL = { cfg.OffsetX - cfg.Width / 2 + rTop, cfg.OffsetY - cfg.Height / 2 + rTop - delta_y_top };
+    c.TR = { cfg.OffsetX + cfg.Width / 2 - rTop, cfg.OffsetY - cfg.Height / 2 + rTop + delta_y_top };
+    c.BL = { cfg.OffsetX - cfg.Width / 2 + rBottom, cfg.OffsetY + cfg.Height / 2 - rBottom - delta_y_bottom };
+    c.BR = { cfg.OffsetX + cfg.Width / 2 - rBottom, cfg.OffsetY + cfg.Height / 2 - rBottom + delta_y_bottom };
+    c.rTop = rTop;
+    c.rBottom = rBottom;
+    return c;
+}
+
+// Closed outline of the filled eye around (centerX, centerY): four corner arcs joined by
+// the edges, counter-clockwise on screen like EyeBatchGenerate. segments <= 0 picks per
+// corner from the radius. out must hold 4 * (ARC_TABLE_MAX_SEGMENTS + 1) points.
+inline int EyeOutline(const EyeConfig &cfg, float centerX, float centerY, int segments, Vector2 *out) {
+    EyeCorners c = EyeCornersFor(cfg);
+    const Vector2 centers[4] = { c.TL, c.BL, c.BR, c.TR };
+    const float radii[4] = { c.rTop, c.rBottom, c.rBottom, c.rTop };
+    const int quadrants[4] = { 2, 1, 0, 3 };
+
+    int count = 0;
+    for (int k = 0; k < 4; k++) {
+        int s = ArcSegmentsOrAuto(segments, radii[k]);
+        if (s > ARC_TABLE_MAX_SEGMENTS) s = ARC_TABLE_MAX_SEGMENTS;
+        const Vector2 *dir = QuarterArcDirections(s);
+        Vector2 center = { centerX + centers[k].x, centerY + centers[k].y };
+        for (int i = s; i >= 0; i--) out[count++] = ArcTablePoint(dir, i, quadrants[k], center, radii[k]);
+    }
+    return count;
+}
+
+// Geometry of EyeDrawer::Draw for one config, centred on (0, 0)
+inline void EyeMeshTessellate(EyeMesh &mesh, const EyeConfig &cfg) {
+    mesh.lines.clear();
+    mesh.triangles.clear();
+
+    EyeCorners c = EyeCornersFor(cfg);
+    Vector2 TL = c.TL, TR = c.TR, BL = c.BL, BR = c.BR;
+    float rTop = c.rTop, rBottom = c.rBottom;
+
+    // Top, bottom and vertical lines
+    mesh.lines.insert(mesh.lines.end(), { TL, TR, BL, BR });
+    mesh.lines.insert(mesh.lines.end(), { Vector2{TL.x - rTop, TL.y}, Vector2{BL.x - rBottom, BL.y} });
+    mesh.lines.insert(mesh.lines.end(), { Vector2{TR.x + rTop, TR.y}, Vector2{BR.x + rBottom, BR.y} });
+
+    // Rounded corners
+    if (rTop > 0) {
+        EyeMeshAddSector(mesh.triangles, TL, rTop, 2); // 180-270
+        EyeMeshAddSector(mesh.triangles, TR, rTop, 3); // 270-360
+    }
+    if (rBottom > 0) {
+        EyeMeshAddSector(mesh.triangles, BL, rBottom, 1); // 90-180
+        EyeMeshAddSector(mesh.triangles, BR, rBottom, 0); // 0-90
+    }
+
+    // Slope triangles
+    if (cfg.Slope_Top != 0) {
+        Vector2 apex = {(TL.x + TR.x) / 2, TL.y - cfg.Slope_Top * cfg.Height};
+        mesh.lines.insert(mesh.lines.end(), { TL, TR, TR, apex, apex, TL });
+    }
+    if (cfg.Slope_Bottom != 0) {
+        Vector2 apex = {(BL.x + BR.x) / 2, BL.y + cfg.Slope_Bottom * cfg.Height};
+        mesh.lines.insert(mesh.lines.end(), { BL, BR, BR, apex, apex, BL });
+    }
+}
+
+// --- Right eye ---
+// The right eye is the left config with the flagged edges mirrored: Inverse_Offset_Top
+// and Inverse_Offset_Bottom flip that edge's slope, and with both set the horizontal
+// offset flips too, making the pair symmetric about the face centre. The Inverse_Radius_*
+// flags don't change the geometry: both corners of an edge share one radius.
+inline EyeConfig EyeConfigRight(const EyeConfig &cfg) {
+    EyeConfig right = cfg;
+    if (cfg.Inverse_Offset_Top) right.Slope_Top = -cfg.Slope_Top;
+    if (cfg.Inverse_Offset_Bottom) right.Slope_Bottom = -cfg.Slope_Bottom;
+    if (cfg.Inverse_Offset_Top && cfg.Inverse_Offset_Bottom) right.OffsetX = -cfg.OffsetX;
+    return right;
+}
+
+// cfg reflected about x = 0
+inline EyeConfig EyeConfigMirrored(const EyeConfig &cfg) {
+    EyeConfig m = cfg;
+    m.OffsetX = -cfg.OffsetX;
+    m.Slope_Top = -cfg.Slope_Top;
+    m.Slope_Bottom = -cfg.Slope_Bottom;
+    return m;
+}
+
+// Same shape floats (compared as values, so 0 == -0)
+inline bool EyeConfigShapeEqual(const EyeConfig &a, const EyeConfig &b) {
+    const float *pa = &a.OffsetX, *pb = &b.OffsetX;
+    for (int k = 0; k < 8; k++) {
+        if (pa[k] != pb[k]) return false;
+    }
+    return true;
+}
+
+enum EyeMeshReuse {
+    EYE_REUSE_TRANSLATE = 0, // right mesh = left mesh moved
+    EYE_REUSE_MIRROR,        // right mesh = left mesh with x negated
+    EYE_REUSE_NONE           // asymmetric, tessellate the right eye itself
+};
+
+// EyeMeshReuseFor: How the right eye can be drawn from the left eye's mesh. Sloped
+// eyes are never mirrored: the slope-triangle apex hangs off TL/BL, which a reflection
+// swaps with TR/BR, so the mirrored outline would not be the right eye's.
+inline EyeMeshReuse EyeMeshReuseFor(const EyeConfig &left, const EyeConfig &right) {
+    if (EyeConfigShapeEqual(left, right)) return EYE_REUSE_TRANSLATE;
+    if (left.Slope_Top == 0 && left.Slope_Bottom == 0 &&
+        EyeConfigShapeEqual(EyeConfigMirrored(left), right)) return EYE_REUSE_MIRROR;
+    return EYE_REUSE_NONE;
+}
+
+// --- EyeMeshCache ---
+// 2-way set associative on the config hash: a config that has not changed since the
+// last frame returns its mesh untouched, a moved slider re-tessellates once. Two ways
+// per set keep an asymmetric left/right pair from evicting each other when they collide.
+class EyeMeshCache {
+public:
+    const EyeMesh &Get(const EyeConfig &cfg) {
+        uint64_t key = EyeConfigHash(cfg);
+        int set = (int)(key % SetCount);
+        EyeMesh *ways = slots[set];
+        for (int w = 0; w < WayCount; w++) {
+            EyeMesh &mesh = ways[w];
+            if (mesh.valid && mesh.key == key && memcmp(&mesh.cfg, &cfg, sizeof(EyeConfig)) == 0) {
+                recent[set] = (uint8_t)w;
+                return mesh;
+            }
+        }
+
+        // Miss: replace the way not used last
+        int w = recent[set] ^ 1;
+        EyeMesh &mesh = ways[w];
+        EyeMeshTessellate(mesh, cfg);
+        mesh.cfg = cfg;
+        mesh.key = key;
+        mesh.valid = true;
+        recent[set] = (uint8_t)w;
+        rebuilds++;
+        return mesh;
+    }
+
+    // Number of tessellations done so far, for profiling
+    int Rebuilds() const { return rebuilds; }
+
+private:
+    static const int SetCount = 4;
+    static const int WayCount = 2;
+    EyeMesh slots[SetCount][WayCount];
+    uint8_t recent[SetCount] = {}; // most recently used way per set
+    int rebuilds = 0;
+};
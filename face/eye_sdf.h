@@ -0,0 +1,257 @@
+#pragma once
+#include "eye_mesh.h"
+#include "simd_dispatch.h"
+#include "soft_raster.h"
+#include <math.h>
+
+// --- Eye signed distance ---
+// Exact distance to the eye outline of EyeOutline, negative inside. The outline is an
+// octagon (the eight arc endpoints) plus the circular caps of the four corner arcs:
+// the distance is the closest of the four straight edges and the four quarter arcs, and
+// a point is inside if it is inside the octagon or inside one of the corner sectors.
+// No tessellation, so the result does not depend on segment count or resolution.
+struct EyeSdf {
+    // Straight edges, top / left / bottom / right: start point and direction
+    float edgeAx[4], edgeAy[4], edgeDx[4], edgeDy[4], edgeInvLen2[4];
+    // Corner arcs, TL / BL / BR / TR: centre, radius, and the quadrant as a sign per axis
+    float arcCx[4], arcCy[4], arcR[4], arcSx[4], arcSy[4];
+    // Octagon for the inside test: vertices and dx/dy of the edge leaving each one
+    float polyX[8], polyY[8], polyDxDy[8];
+};
+
+// EyeSdfBuild: Per-eye constants for a config drawn around (centerX, centerY)
+inline EyeSdf EyeSdfBuild(const EyeConfig &cfg, float centerX, float centerY) {
+    EyeCorners c = EyeCornersFor(cfg);
+    const Vector2 centers[4] = { c.TL, c.BL, c.BR, c.TR };
+    const float radii[4] = { c.rTop, c.rBottom, c.rBottom, c.rTop };
+    const float signX[4] = { -1, -1, 1, 1 };
+    const float signY[4] = { -1, 1, 1, -1 };
+
+    EyeSdf sdf;
+    for (int k = 0; k < 4; k++) {
+        sdf.arcCx[k] = centerX + centers[k].x;
+        sdf.arcCy[k] = centerY + centers[k].y;
+        sdf.arcR[k] = radii[k];
+        sdf.arcSx[k] = signX[k];
+        sdf.arcSy[k] = signY[k];
+    }
+
+    // Octagon in EyeOutline order: each arc contributes its start and end point
+    Vector2 poly[8] = {
+        { sdf.arcCx[0], sdf.arcCy[0] - radii[0] }, { sdf.arcCx[0] - radii[0], sdf.arcCy[0] }, // TL: top, left
+        { sdf.arcCx[1] - radii[1], sdf.arcCy[1] }, { sdf.arcCx[1], sdf.arcCy[1] + radii[1] }, // BL: left, bottom
+        { sdf.arcCx[2], sdf.arcCy[2] + radii[2] }, { sdf.arcCx[2] + radii[2], sdf.arcCy[2] }, // BR: bottom, right
+        { sdf.arcCx[3] + radii[3], sdf.arcCy[3] }, { sdf.arcCx[3], sdf.arcCy[3] - radii[3] }, // TR: right, top
+    };
+    for (int i = 0; i < 8; i++) {
+        Vector2 a = poly[i], b = poly[(i + 1) % 8];
+        sdf.polyX[i] = a.x;
+        sdf.polyY[i] = a.y;
+        sdf.polyDxDy[i] = (b.y != a.y) ? (b.x - a.x) / (b.y - a.y) : 0.0f;
+    }
+
+    // Straight edges join one arc's end to the next arc's start: 7-0 top, 1-2 left, 3-4 bottom, 5-6 right
+    const int edgeStart[4] = { 7, 1, 3, 5 };
+    for (int k = 0; k < 4; k++) {
+        Vector2 a = poly[edgeStart[k]], b = poly[(edgeStart[k] + 1) % 8];
+        float dx = b.x - a.x, dy = b.y - a.y;
+        float len2 = dx * dx + dy * dy;
+        sdf.edgeAx[k] = a.x;
+        sdf.edgeAy[k] = a.y;
+        sdf.edgeDx[k] = dx;
+        sdf.edgeDy[k] = dy;
+        sdf.edgeInvLen2[k] = (len2 > 0.0f) ? 1.0f / len2 : 0.0f;
+    }
+    return sdf;
+}
+
+// EyeSdfEval: Signed distance in pixels from (x, y) to the outline, negative inside
+inline float EyeSdfEval(const EyeSdf &sdf, float x, float y) {
+    float dist2 = INFINITY;
+    for (int k = 0; k < 4; k++) {
+        float px = x - sdf.edgeAx[k], py = y - sdf.edgeAy[k];
+        float h = fminf(fmaxf((px * sdf.edgeDx[k] + py * sdf.edgeDy[k]) * sdf.edgeInvLen2[k], 0.0f), 1.0f);
+        float ex = px - sdf.edgeDx[k] * h, ey = py - sdf.edgeDy[k] * h;
+        dist2 = fminf(dist2, ex * ex + ey * ey);
+    }
+    float dist = sqrtf(dist2);
+
+    // Outside its quadrant an arc is closest at an endpoint, which the edges already cover
+    bool inSector = false;
+    for (int k = 0; k < 4; k++) {
+        float dx = x - sdf.arcCx[k], dy = y - sdf.arcCy[k];
+        if (dx * sdf.arcSx[k] < 0.0f || dy * sdf.arcSy[k] < 0.0f) continue;
+        float len = sqrtf(dx * dx + dy * dy);
+        dist = fminf(dist, fabsf(len - sdf.arcR[k]));
+        inSector |= len < sdf.arcR[k];
+    }
+
+    // Crossing test against the octagon
+    bool inOctagon = false;
+    for (int i = 0; i < 8; i++) {
+        float ay = sdf.polyY[i], by = sdf.polyY[(i + 1) % 8];
+        if ((ay > y) != (by > y) && x < sdf.polyX[i] + (y - ay) * sdf.polyDxDy[i]) inOctagon = !inOctagon;
+    }
+    return (inOctagon || inSector) ? -dist : dist;
+}
+
+// O(1) containment
+inline bool EyeSdfContains(const EyeSdf &sdf, float x, float y) { return EyeSdfEval(sdf, x, y) < 0.0f; }
+
+// Scalar row kernel, also used for the tail the vector kernels leave over
+inline void EyeSdfRowScalar(const EyeSdf &sdf, float x0, float y, int begin, int end, float *out) {
+    for (int i = begin; i < end; i++) out[i] = EyeSdfEval(sdf, x0 + i, y);
+}
+
+#if FACE_SIMD_X86
+// SSE2 row kernel: 4 pixels per iteration. Returns the first pixel it did not process.
+inline int EyeSdfRowSSE2(const EyeSdf &sdf, float x0, float y, int count, float *out) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 lane = _mm_setr_ps(0, 1, 2, 3);
+    const __m128 vy = _mm_set1_ps(y);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_add_ps(_mm_set1_ps(x0 + i), lane);
+
+        __m128 dist2 = _mm_set1_ps(INFINITY);
+        for (int k = 0; k < 4; k++) {
+            __m128 px = _mm_sub_ps(vx, _mm_set1_ps(sdf.edgeAx[k]));
+            __m128 py = _mm_sub_ps(vy, _mm_set1_ps(sdf.edgeAy[k]));
+            __m128 ddx = _mm_set1_ps(sdf.edgeDx[k]), ddy = _mm_set1_ps(sdf.edgeDy[k]);
+            __m128 h = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(px, ddx), _mm_mul_ps(py, ddy)), _mm_set1_ps(sdf.edgeInvLen2[k]));
+            h = _mm_min_ps(_mm_max_ps(h, zero), one);
+            __m128 ex = _mm_sub_ps(px, _mm_mul_ps(ddx, h)), ey = _mm_sub_ps(py, _mm_mul_ps(ddy, h));
+            dist2 = _mm_min_ps(dist2, _mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)));
+        }
+        __m128 dist = _mm_sqrt_ps(dist2);
+
+        __m128 inSector = zero;
+        for (int k = 0; k < 4; k++) {
+            __m128 dx = _mm_sub_ps(vx, _mm_set1_ps(sdf.arcCx[k]));
+            __m128 dy = _mm_sub_ps(vy, _mm_set1_ps(sdf.arcCy[k]));
+            __m128 wedge = _mm_and_ps(_mm_cmpge_ps(_mm_mul_ps(dx, _mm_set1_ps(sdf.arcSx[k])), zero),
+                                      _mm_cmpge_ps(_mm_mul_ps(dy, _mm_set1_ps(sdf.arcSy[k])), zero));
+            __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+            __m128 r = _mm_set1_ps(sdf.arcR[k]);
+            __m128 arcDist = _mm_andnot_ps(signBit, _mm_sub_ps(len, r));
+            dist = _mm_or_ps(_mm_and_ps(wedge, _mm_min_ps(dist, arcDist)), _mm_andnot_ps(wedge, dist));
+            inSector = _mm_or_ps(inSector, _mm_and_ps(wedge, _mm_cmplt_ps(len, r)));
+        }
+
+        __m128 inOctagon = zero;
+        for (int e = 0; e < 8; e++) {
+            __m128 ay = _mm_set1_ps(sdf.polyY[e]), by = _mm_set1_ps(sdf.polyY[(e + 1) % 8]);
+            __m128 straddle = _mm_xor_ps(_mm_cmpgt_ps(ay, vy), _mm_cmpgt_ps(by, vy));
+            __m128 xCross = _mm_add_ps(_mm_set1_ps(sdf.polyX[e]), _mm_mul_ps(_mm_sub_ps(vy, ay), _mm_set1_ps(sdf.polyDxDy[e])));
+            inOctagon = _mm_xor_ps(inOctagon, _mm_and_ps(straddle, _mm_cmplt_ps(vx, xCross)));
+        }
+
+        __m128 inside = _mm_or_ps(inOctagon, inSector);
+        _mm_storeu_ps(out + i, _mm_xor_ps(dist, _mm_and_ps(inside, signBit)));
+    }
+    return i;
+}
+
+// AVX2 row kernel: 8 pixels per iteration, FMA for the dot products
+FACE_TARGET_AVX2 inline int EyeSdfRowAVX2(const EyeSdf &sdf, float x0, float y, int count, float *out) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256 lane = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256 vy = _mm256_set1_ps(y);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 vx = _mm256_add_ps(_mm256_set1_ps(x0 + i), lane);
+
+        __m256 dist2 = _mm256_set1_ps(INFINITY);
+        for (int k = 0; k < 4; k++) {
+            __m256 px = _mm256_sub_ps(vx, _mm256_set1_ps(sdf.edgeAx[k]));
+            __m256 py = _mm256_sub_ps(vy, _mm256_set1_ps(sdf.edgeAy[k]));
+            __m256 ddx = _mm256_set1_ps(sdf.edgeDx[k]), ddy = _mm256_set1_ps(sdf.edgeDy[k]);
+            __m256 h = _mm256_mul_ps(_mm256_fmadd_ps(px, ddx, _mm256_mul_ps(py, ddy)), _mm256_set1_ps(sdf.edgeInvLen2[k]));
+            h = _mm256_min_ps(_mm256_max_ps(h, zero), one);
+            __m256 ex = _mm256_fnmadd_ps(ddx, h, px), ey = _mm256_fnmadd_ps(ddy, h, py);
+            dist2 = _mm256_min_ps(dist2, _mm256_fmadd_ps(ex, ex, _mm256_mul_ps(ey, ey)));
+        }
+        __m256 dist = _mm256_sqrt_ps(dist2);
+
+        __m256 inSector = zero;
+        for (int k = 0; k < 4; k++) {
+            __m256 dx = _mm256_sub_ps(vx, _mm256_set1_ps(sdf.arcCx[k]));
+            __m256 dy = _mm256_sub_ps(vy, _mm256_set1_ps(sdf.arcCy[k]));
+            __m256 wedge = _mm256_and_ps(_mm256_cmp_ps(_mm256_mul_ps(dx, _mm256_set1_ps(sdf.arcSx[k])), zero, _CMP_GE_OQ),
+                                         _mm256_cmp_ps(_mm256_mul_ps(dy, _mm256_set1_ps(sdf.arcSy[k])), zero, _CMP_GE_OQ));
+            __m256 len = _mm256_sqrt_ps(_mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy)));
+            __m256 r = _mm256_set1_ps(sdf.arcR[k]);
+            __m256 arcDist = _mm256_andnot_ps(signBit, _mm256_sub_ps(len, r));
+            dist = _mm256_blendv_ps(dist, _mm256_min_ps(dist, arcDist), wedge);
+            inSector = _mm256_or_ps(inSector, _mm256_and_ps(wedge, _mm256_cmp_ps(len, r, _CMP_LT_OQ)));
+        }
+
+        __m256 inOctagon = zero;
+        for (int e = 0; e < 8; e++) {
+            __m256 ay = _mm256_set1_ps(sdf.polyY[e]), by = _mm256_set1_ps(sdf.polyY[(e + 1) % 8]);
+            __m256 straddle = _mm256_xor_ps(_mm256_cmp_ps(ay, vy, _CMP_GT_OQ), _mm256_cmp_ps(by, vy, _CMP_GT_OQ));
+            __m256 xCross = _mm256_fmadd_ps(_mm256_sub_ps(vy, ay), _mm256_set1_ps(sdf.polyDxDy[e]), _mm256_set1_ps(sdf.polyX[e]));
+            inOctagon = _mm256_xor_ps(inOctagon, _mm256_and_ps(straddle, _mm256_cmp_ps(vx, xCross, _CMP_LT_OQ)));
+        }
+
+        __m256 inside = _mm256_or_ps(inOctagon, inSector);
+        _mm256_storeu_ps(out + i, _mm256_xor_ps(dist, _mm256_and_ps(inside, signBit)));
+    }
+    return i;
+}
+#endif
+
+// EyeSdfRow: Distances for `count` pixels at (x0 + i, y), 4 or 8 per instruction
+inline void EyeSdfRow(const EyeSdf &sdf, float x0, float y, int count, float *out, SimdLevel level = DetectSimdLevel()) {
+    int done = 0;
+#if FACE_SIMD_X86
+    if (level >= SIMD_AVX2) done = EyeSdfRowAVX2(sdf, x0, y, count, out);
+    else if (level >= SIMD_SSE2) done = EyeSdfRowSSE2(sdf, x0, y, count, out);
+#else
+    (void)level;
+#endif
+    EyeSdfRowScalar(sdf, x0, y, done, count, out);
+}
+
+// SoftDrawEyeSdf: One-pass anti-aliased fill from the distance field, coverage
+// clamp(0.5 - d) at each pixel centre. Same contract as SoftDrawEye.
+inline void SoftDrawEyeSdf(SoftCanvas &canvas, float centerX, float centerY, const EyeConfig &cfg, Color color, const SoftRect *clip = nullptr) {
+    EyeSdf sdf = EyeSdfBuild(cfg, centerX, centerY);
+
+    // Bounds of the shape: the octagon plus a pixel of anti-aliasing ramp
+    float minX = sdf.polyX[0], maxX = sdf.polyX[0], minY = sdf.polyY[0], maxY = sdf.polyY[0];
+    for (int i = 1; i < 8; i++) {
+        minX = fminf(minX, sdf.polyX[i]); maxX = fmaxf(maxX, sdf.polyX[i]);
+        minY = fminf(minY, sdf.polyY[i]); maxY = fmaxf(maxY, sdf.polyY[i]);
+    }
+    SoftRect area = clip ? *clip : canvas.Bounds();
+    int x0 = (int)floorf(minX) - 1, y0 = (int)floorf(minY) - 1;
+    int x1 = (int)ceilf(maxX) + 1, y1 = (int)ceilf(maxY) + 1;
+    if (x0 < area.x) x0 = area.x;
+    if (y0 < area.y) y0 = area.y;
+    if (x1 > area.x + area.width) x1 = area.x + area.width;
+    if (y1 > area.y + area.height) y1 = area.y + area.height;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > canvas.width) x1 = canvas.width;
+    if (y1 > canvas.height) y1 = canvas.height;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    std::vector<float> &row = SoftRasterScratch();
+    row.resize(x1 - x0);
+    SimdLevel level = DetectSimdLevel();
+    for (int y = y0; y < y1; y++) {
+        EyeSdfRow(sdf, x0 + 0.5f, y + 0.5f, x1 - x0, row.data(), level);
+        unsigned char *dst = canvas.pixels.data() + (size_t)y * canvas.Stride() + (size_t)x0 * canvas.format;
+        for (int x = 0; x < x1 - x0; x++, dst += canvas.format) {
+            float coverage = fminf(fmaxf(0.5f - row[x], 0.0f), 1.0f);
+            if (coverage > 1.0f / 512.0f) SoftBlendPixel(dst, canvas.format, color, coverage);
+        }
+    }
+}
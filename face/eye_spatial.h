@@ -0,0 +1,135 @@
+#pragma once
+#include "eye_fleet.h"
+#include "raylib_types.h"
+#include <math.h>
+#include <vector>
+
+// --- Spatial grid ---
+// Uniform grid over point positions (face centres) for visibility queries. A counting
+// sort buckets the items into one flat index array, cell after cell, so a query walks
+// only the cells a rectangle overlaps and each cell's items are contiguous. Built once
+// when positions change; a query costs the cells it touches plus the items in them.
+struct EyeSpatialGrid {
+    float x = 0.0f, y = 0.0f; // world position of cell (0, 0)
+    float cellSize = 1.0f;
+    int columns = 0, rows = 0;
+    std::vector<int> cellStart; // cell c holds items[cellStart[c], cellStart[c + 1])
+    std::vector<int> items;
+
+    int Cells() const { return columns * rows; }
+    int CellCount(int c) const { return cellStart[c + 1] - cellStart[c]; }
+    const int *CellItems(int c) const { return items.data() + cellStart[c]; }
+    Rectangle CellRect(int c) const { return Rectangle{ x + (c % columns) * cellSize, y + (c / columns) * cellSize, cellSize, cellSize }; }
+
+    // EyeSpatialGrid::Build: Buckets positions[0, count) into square cells of `size`
+    void Build(const Vector2 *positions, int count, float size) {
+        cellSize = size > 0.0f ? size : 1.0f;
+        float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+        for (int i = 0; i < count; i++) {
+            minX = fminf(minX, positions[i].x);
+            minY = fminf(minY, positions[i].y);
+            maxX = fmaxf(maxX, positions[i].x);
+            maxY = fmaxf(maxY, positions[i].y);
+        }
+        if (count <= 0) minX = minY = maxX = maxY = 0.0f;
+        x = minX;
+        y = minY;
+        columns = (int)((maxX - minX) / cellSize) + 1;
+        rows = (int)((maxY - minY) / cellSize) + 1;
+
+        // Count per cell, prefix sum, then place each item at its cell's cursor
+        std::vector<int> cellOf(count);
+        cellStart.assign((size_t)Cells() + 1, 0);
+        for (int i = 0; i < count; i++) {
+            int c = Column(positions[i].x) + Row(positions[i].y) * columns;
+            cellOf[i] = c;
+            cellStart[c + 1]++;
+        }
+        for (int c = 0; c < Cells(); c++) cellStart[c + 1] += cellStart[c];
+        std::vector<int> cursor(cellStart.begin(), cellStart.end() - 1);
+        items.resize(count);
+        for (int i = 0; i < count; i++) items[cursor[cellOf[i]]++] = i;
+    }
+
+    // EyeSpatialGrid::CellRange: Cells overlapping [x0, x1] x [y0, y1], inclusive;
+    // false when the rectangle misses the grid
+    bool CellRange(float x0, float y0, float x1, float y1, int &c0, int &r0, int &c1, int &r1) const {
+        if (Cells() == 0 || x1 < x || y1 < y || x0 > x + columns * cellSize || y0 > y + rows * cellSize) return false;
+        c0 = Column(x0);
+        r0 = Row(y0);
+        c1 = Column(x1);
+        r1 = Row(y1);
+        return true;
+    }
+
+private:
+    int Column(float px) const {
+        float c = floorf((px - x) / cellSize);
+        return c < 0.0f ? 0 : (c >= columns ? columns - 1 : (int)c);
+    }
+    int Row(float py) const {
+        float r = floorf((py - y) / cellSize);
+        return r < 0.0f ? 0 : (r >= rows ? rows - 1 : (int)r);
+    }
+};
+
+// EyeFleetSpatialGrid: Grid over the face centres of `count` faces, `facesPerCell`
+// faces across each cell
+inline void EyeFleetSpatialGrid(const EyeFleetLayout &layout, int count, int facesPerCell, EyeSpatialGrid &grid) {
+    std::vector<Vector2> centres(count);
+    for (int i = 0; i < count; i++) centres[i] = layout.FaceCenter(i);
+    grid.Build(centres.data(), count, layout.cellWidth * facesPerCell);
+}
+
+// --- Fleet culling ---
+// Level of detail from the on-screen size of a face cell:
+//   full   at least EYE_FLEET_DOT_PIXELS wide: animated and tessellated every frame
+//   dot    smaller: one square in the face's status colour, not animated
+//   cell   below a pixel, per-face dots would pile onto the same pixels: one square
+//          per grid cell instead
+// Faces outside the view are skipped, so the work per frame follows what is on screen,
+// not the size of the fleet.
+#define EYE_FLEET_DOT_PIXELS 8.0f
+
+struct EyeFleetView {
+    std::vector<int> full;  // face ids, in mesh order
+    std::vector<int> dots;  // face ids
+    std::vector<int> cells; // non-empty grid cells
+    float facePixels = 0.0f; // on-screen width of a face cell
+};
+
+// EyeFleetCull: Sorts the faces of `layout` that overlap `view` (a world rectangle seen
+// at `zoom` pixels per world unit) into the levels above
+inline void EyeFleetCull(const EyeSpatialGrid &grid, const EyeFleetLayout &layout, Rectangle view, float zoom, EyeFleetView &out,
+                         float dotPixels = EYE_FLEET_DOT_PIXELS) {
+    out.full.clear();
+    out.dots.clear();
+    out.cells.clear();
+    out.facePixels = layout.cellWidth * zoom;
+
+    // A face reaches half a cell past its centre
+    float hx = layout.cellWidth * 0.5f, hy = layout.cellHeight * 0.5f;
+    float x0 = view.x - hx, y0 = view.y - hy, x1 = view.x + view.width + hx, y1 = view.y + view.height + hy;
+    int c0, r0, c1, r1;
+    if (!grid.CellRange(x0, y0, x1, y1, c0, r0, c1, r1)) return;
+
+    if (out.facePixels < 1.0f) {
+        for (int r = r0; r <= r1; r++) {
+            for (int c = r * grid.columns + c0; c <= r * grid.columns + c1; c++) {
+                if (grid.CellCount(c) > 0) out.cells.push_back(c);
+            }
+        }
+        return;
+    }
+
+    std::vector<int> &dst = out.facePixels < dotPixels ? out.dots : out.full;
+    for (int r = r0; r <= r1; r++) {
+        for (int c = r * grid.columns + c0; c <= r * grid.columns + c1; c++) {
+            const int *ids = grid.CellItems(c);
+            for (int k = 0, n = grid.CellCount(c); k < n; k++) {
+                Vector2 p = layout.FaceCenter(ids[k]);
+                if (p.x > x0 && p.x < x1 && p.y > y0 && p.y < y1) dst.push_back(ids[k]);
+            }
+        }
+    }
+}
@@ -0,0 +1,182 @@
+#pragma once
+#include "eye_config.h"
+#include "simd_dispatch.h"
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+// --- Critically damped springs ---
+// Every EyeConfig float chases its target as a critically damped spring with its own
+// angular frequency w. The step uses the closed-form solution, with d = x - target:
+//   a  = v + w * d
+//   x' = target + (d + a * h) * e^(-w h)
+//   v' = (v - w * h * a) * e^(-w h)
+// It is exact for any h, so a long frame can neither overshoot nor blow up. The only
+// transcendental is e^(-w h), computed once per field whenever h changes; the eight
+// fields of a face are one 256-bit vector and each lane carries its own w.
+// A field within EYE_SPRING_REST of its target and slower than that snaps to rest;
+// left alone, the decay runs into denormals and a settled face gets slower to step.
+#define EYE_SPRING_REST 1e-4f
+
+// Per-field constants for one step length
+struct EyeSpringCoeffs {
+    float h = 0.0f;
+    float decay[8] = {};  // e^(-w h)
+    float omegaH[8] = {}; // w h
+    float omega[8] = {};  // w
+};
+
+inline void EyeSpringCoeffsFor(const float *omega, float h, EyeSpringCoeffs &c) {
+    c.h = h;
+    for (int k = 0; k < 8; k++) {
+        c.omega[k] = omega[k];
+        c.omegaH[k] = omega[k] * h;
+        c.decay[k] = expf(-omega[k] * h);
+    }
+}
+
+// Scalar kernel, also used for the tail the vector kernels leave over
+inline void EyeSpringStepScalar(EyeConfig *pos, float *vel, const EyeConfig *target, const EyeSpringCoeffs &c, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+        float *x = &pos[i].OffsetX, *v = vel + i * 8;
+        const float *t = &target[i].OffsetX;
+        for (int k = 0; k < 8; k++) {
+            float d = x[k] - t[k];
+            float a = v[k] + c.omega[k] * d;
+            float nd = (d + a * c.h) * c.decay[k];
+            float nv = (v[k] - c.omegaH[k] * a) * c.decay[k];
+            bool rest = fabsf(nd) < EYE_SPRING_REST && fabsf(nv) < EYE_SPRING_REST;
+            x[k] = rest ? t[k] : t[k] + nd;
+            v[k] = rest ? 0.0f : nv;
+        }
+    }
+}
+
+#if FACE_SIMD_X86
+// SSE2 kernel: one face as two 4-field halves
+inline int EyeSpringStepSSE2(EyeConfig *pos, float *vel, const EyeConfig *target, const EyeSpringCoeffs &c, int count) {
+    const __m128 h = _mm_set1_ps(c.h);
+    const __m128 rest = _mm_set1_ps(EYE_SPRING_REST), absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    for (int half = 0; half < 8; half += 4) {
+        const __m128 decay = _mm_loadu_ps(c.decay + half), omega = _mm_loadu_ps(c.omega + half), omegaH = _mm_loadu_ps(c.omegaH + half);
+        for (int i = 0; i < count; i++) {
+            float *x = &pos[i].OffsetX + half, *v = vel + i * 8 + half;
+            __m128 t = _mm_loadu_ps(&target[i].OffsetX + half);
+            __m128 d = _mm_sub_ps(_mm_loadu_ps(x), t);
+            __m128 vv = _mm_loadu_ps(v);
+            __m128 a = _mm_add_ps(vv, _mm_mul_ps(omega, d));
+            __m128 nd = _mm_mul_ps(_mm_add_ps(d, _mm_mul_ps(a, h)), decay);
+            __m128 nv = _mm_mul_ps(_mm_sub_ps(vv, _mm_mul_ps(omegaH, a)), decay);
+            __m128 settled = _mm_and_ps(_mm_cmplt_ps(_mm_and_ps(nd, absMask), rest), _mm_cmplt_ps(_mm_and_ps(nv, absMask), rest));
+            _mm_storeu_ps(x, _mm_add_ps(t, _mm_andnot_ps(settled, nd)));
+            _mm_storeu_ps(v, _mm_andnot_ps(settled, nv));
+        }
+    }
+    return count;
+}
+
+// AVX2 kernel: one face per 256-bit vector
+FACE_TARGET_AVX2 inline int EyeSpringStepAVX2(EyeConfig *pos, float *vel, const EyeConfig *target, const EyeSpringCoeffs &c, int count) {
+    const __m256 h = _mm256_set1_ps(c.h);
+    const __m256 rest = _mm256_set1_ps(EYE_SPRING_REST), absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    const __m256 decay = _mm256_loadu_ps(c.decay), omega = _mm256_loadu_ps(c.omega), omegaH = _mm256_loadu_ps(c.omegaH);
+    for (int i = 0; i < count; i++) {
+        float *x = &pos[i].OffsetX, *v = vel + i * 8;
+        __m256 t = _mm256_loadu_ps(&target[i].OffsetX);
+        __m256 d = _mm256_sub_ps(_mm256_loadu_ps(x), t);
+        __m256 vv = _mm256_loadu_ps(v);
+        __m256 a = _mm256_fmadd_ps(omega, d, vv);
+        __m256 nd = _mm256_mul_ps(_mm256_fmadd_ps(a, h, d), decay);
+        __m256 nv = _mm256_mul_ps(_mm256_fnmadd_ps(omegaH, a, vv), decay);
+        __m256 settled = _mm256_and_ps(_mm256_cmp_ps(_mm256_and_ps(nd, absMask), rest, _CMP_LT_OQ),
+                                       _mm256_cmp_ps(_mm256_and_ps(nv, absMask), rest, _CMP_LT_OQ));
+        _mm256_storeu_ps(x, _mm256_add_ps(t, _mm256_andnot_ps(settled, nd)));
+        _mm256_storeu_ps(v, _mm256_andnot_ps(settled, nv));
+    }
+    return count;
+}
+#endif
+
+// EyeSpringStep: Advances `count` faces by c.h seconds. vel holds 8 floats per face.
+inline void EyeSpringStep(EyeConfig *pos, float *vel, const EyeConfig *target, const EyeSpringCoeffs &c, int count, SimdLevel level = DetectSimdLevel()) {
+    int done = 0;
+#if FACE_SIMD_X86
+    if (level >= SIMD_AVX2) done = EyeSpringStepAVX2(pos, vel, target, c, count);
+    else if (level >= SIMD_SSE2) done = EyeSpringStepSSE2(pos, vel, target, c, count);
+#else
+    (void)level;
+#endif
+    EyeSpringStepScalar(pos, vel, target, c, done, count);
+}
+
+// --- EyeSpringBatch ---
+// Many faces easing towards their targets. Update runs whole fixed steps of `step`
+// seconds with constants computed once, and carries the remainder to the next frame.
+// After a long stall the missed steps collapse into one exact step instead of a burst.
+struct EyeSpringBatch {
+    // Angular frequency per field, rad/s; settles to ~1% in about 6.6 / w seconds
+    float omega[8] = { 30, 30, 25, 25, 20, 20, 20, 20 };
+    float step = 1.0f / 120.0f;
+    int maxSteps = 8; // per Update before falling back to one long step
+
+    std::vector<EyeConfig> pos, target;
+    std::vector<float> vel; // 8 per face
+
+    int Count() const { return (int)pos.size(); }
+
+    void Resize(int n, const EyeConfig &cfg) {
+        pos.assign(n, cfg);
+        target.assign(n, cfg);
+        vel.assign((size_t)n * 8, 0.0f);
+        accumulator = 0.0f;
+    }
+
+    // Flags can't spring; they switch straight away
+    void SetTarget(int i, const EyeConfig &cfg) {
+        target[i] = cfg;
+        pos[i].Inverse_Radius_Top = cfg.Inverse_Radius_Top;
+        pos[i].Inverse_Radius_Bottom = cfg.Inverse_Radius_Bottom;
+        pos[i].Inverse_Offset_Top = cfg.Inverse_Offset_Top;
+        pos[i].Inverse_Offset_Bottom = cfg.Inverse_Offset_Bottom;
+    }
+
+    // Jump to cfg at rest
+    void Snap(int i, const EyeConfig &cfg) {
+        pos[i] = target[i] = cfg;
+        for (int k = 0; k < 8; k++) vel[(size_t)i * 8 + k] = 0.0f;
+    }
+
+    // Same constants as in the last call unless omega or h changed
+    const EyeSpringCoeffs &Coeffs(float h) {
+        if (h != coeffs.h || memcmp(omega, coeffs.omega, sizeof(omega)) != 0) EyeSpringCoeffsFor(omega, h, coeffs);
+        return coeffs;
+    }
+
+    // One exact step of any length for every face
+    void Step(float h, SimdLevel level = DetectSimdLevel()) {
+        if (h <= 0.0f || pos.empty()) return;
+        EyeSpringStep(pos.data(), vel.data(), target.data(), Coeffs(h), Count(), level);
+    }
+
+    // EyeSpringBatch::Update: Fixed steps covering dt; returns how many steps of time passed
+    int Update(float dt, SimdLevel level = DetectSimdLevel()) {
+        accumulator += dt;
+        int steps = (int)(accumulator / step);
+        if (steps > maxSteps) {
+            Step(steps * step, level);
+            accumulator -= steps * step;
+            return steps;
+        }
+        steps = 0;
+        while (accumulator >= step) {
+            Step(step, level);
+            accumulator -= step;
+            steps++;
+        }
+        return steps;
+    }
+
+private:
+    EyeSpringCoeffs coeffs;
+    float accumulator = 0.0f;
+};
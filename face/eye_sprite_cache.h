@@ -0,0 +1,236 @@
+#pragma once
+#include "eye_mesh.h"
+#include "soft_raster.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// --- Eye sprite cache ---
+// Content-addressed cache of rendered eyes for the software renderer. An eye's pixels
+// depend only on its shape at the size it is drawn and on where it falls inside a
+// pixel, so that is the key: shape fields scaled to pixels and quantized, plus the
+// sub-pixel phase of the eye centre. Each key is rasterized once into a GRAY8 coverage
+// sprite and every face showing that expression at that size blits it, tinted at blit
+// time so status colours don't split entries. Least recently used sprites are evicted
+// to stay under a byte budget; a sprite bigger than the whole budget is rendered for the
+// call that asked for it and never cached, so the cache holds at most `budget` bytes.
+//
+// The Inverse_* flags aren't part of the key: they only pick the right eye's config
+// (EyeConfigRight) and never reach the outline. Not thread-safe; one cache per thread.
+
+// Quantization steps per pixel for sizes, radii and the eye position; slopes use 1/256
+#define EYE_SPRITE_STEPS 4
+
+struct EyeSpriteKey {
+    int16_t height, width, radiusTop, radiusBottom; // pixels * EYE_SPRITE_STEPS
+    int16_t slopeTop, slopeBottom;                  // * 256
+    uint8_t phaseX, phaseY;                         // eye centre within its pixel, [0, EYE_SPRITE_STEPS)
+
+    bool operator==(const EyeSpriteKey &o) const { return memcmp(this, &o, sizeof(EyeSpriteKey)) == 0; }
+};
+
+static_assert(sizeof(EyeSpriteKey) == 14, "EyeSpriteKey is hashed as raw bytes");
+
+// FNV-1a over the key bytes, as EyeConfigHash
+struct EyeSpriteKeyHash {
+    size_t operator()(const EyeSpriteKey &key) const {
+        const unsigned char *bytes = (const unsigned char *)&key;
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < sizeof(EyeSpriteKey); i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return (size_t)hash;
+    }
+};
+
+// EyeSpriteKeyFor: Key of cfg drawn around (centerX, centerY) at `scale` pixels per
+// design unit; (x, y) gets the pixel the eye centre falls in
+inline EyeSpriteKey EyeSpriteKeyFor(const EyeConfig &cfg, float centerX, float centerY, float scale, int &x, int &y) {
+    const float q = (float)EYE_SPRITE_STEPS;
+    long px = lroundf((centerX + cfg.OffsetX * scale) * q), py = lroundf((centerY + cfg.OffsetY * scale) * q);
+    x = (int)floorf(px / q);
+    y = (int)floorf(py / q);
+
+    EyeSpriteKey key;
+    key.height = (int16_t)lroundf(cfg.Height * scale * q);
+    key.width = (int16_t)lroundf(cfg.Width * scale * q);
+    key.radiusTop = (int16_t)lroundf(cfg.Radius_Top * scale * q);
+    key.radiusBottom = (int16_t)lroundf(cfg.Radius_Bottom * scale * q);
+    key.slopeTop = (int16_t)lroundf(cfg.Slope_Top * 256.0f);
+    key.slopeBottom = (int16_t)lroundf(cfg.Slope_Bottom * 256.0f);
+    key.phaseX = (uint8_t)(px - (long)x * EYE_SPRITE_STEPS);
+    key.phaseY = (uint8_t)(py - (long)y * EYE_SPRITE_STEPS);
+    return key;
+}
+
+// EyeSpriteConfig: The shape a key stands for, in pixels, offset by its sub-pixel phase;
+// drawn around (x, y) from EyeSpriteKeyFor it is exactly what the sprite holds
+inline EyeConfig EyeSpriteConfig(const EyeSpriteKey &key) {
+    const float q = 1.0f / EYE_SPRITE_STEPS;
+    EyeConfig cfg = {};
+    cfg.OffsetX = key.phaseX * q;
+    cfg.OffsetY = key.phaseY * q;
+    cfg.Height = key.height * q;
+    cfg.Width = key.width * q;
+    cfg.Slope_Top = key.slopeTop / 256.0f;
+    cfg.Slope_Bottom = key.slopeBottom / 256.0f;
+    cfg.Radius_Top = key.radiusTop * q;
+    cfg.Radius_Bottom = key.radiusBottom * q;
+    return cfg;
+}
+
+struct EyeSprite {
+    EyeSpriteKey key;
+    SoftCanvas mask; // GRAY8 coverage
+    int originX = 0, originY = 0; // top-left relative to the eye's pixel
+    size_t bytes = 0;             // counted against the budget
+    int prev = -1, next = -1;     // LRU list, most recent first
+};
+
+struct EyeSpriteCacheStats {
+    uint64_t hits = 0, misses = 0, evictions = 0;
+    uint64_t uncached = 0; // misses whose sprite alone was over budget
+    size_t bytes = 0;
+    int sprites = 0;
+
+    double HitRate() const { return hits + misses ? (double)hits / (double)(hits + misses) : 0.0; }
+};
+
+// --- EyeSpriteCache ---
+class EyeSpriteCache {
+public:
+    explicit EyeSpriteCache(size_t budgetBytes = 8u << 20) : budget(budgetBytes) {}
+
+    // Evicts right away if the cache is already over the new budget
+    void SetBudget(size_t budgetBytes) {
+        budget = budgetBytes;
+        Trim(-1);
+    }
+    size_t Budget() const { return budget; }
+
+    const EyeSpriteCacheStats &Stats() const { return stats; }
+    void ResetCounters() { stats.hits = stats.misses = stats.evictions = stats.uncached = 0; }
+
+    void Clear() {
+        index.clear();
+        sprites.clear();
+        free.clear();
+        head = tail = -1;
+        stats.bytes = 0;
+        stats.sprites = 0;
+    }
+
+    // EyeSpriteCache::Get: Sprite for a key, rendered on a miss. The reference is valid
+    // until the next Get
+    const EyeSprite &Get(const EyeSpriteKey &key) {
+        auto it = index.find(key);
+        if (it != index.end()) {
+            stats.hits++;
+            Unlink(it->second);
+            PushFront(it->second);
+            return sprites[it->second];
+        }
+
+        stats.misses++;
+        Render(scratch, key);
+        if (scratch.bytes > budget) {
+            // Caching it would push out everything else and still break the budget
+            stats.uncached++;
+            return scratch;
+        }
+
+        int slot;
+        if (!free.empty()) {
+            slot = free.back();
+            free.pop_back();
+        } else {
+            slot = (int)sprites.size();
+            sprites.emplace_back();
+        }
+        std::swap(sprites[slot], scratch);
+        index.emplace(key, slot);
+        PushFront(slot);
+        stats.bytes += sprites[slot].bytes;
+        stats.sprites++;
+        Trim(slot);
+        return sprites[slot];
+    }
+
+    // EyeSpriteCache::Draw: SoftDrawEye through the cache. cfg is in design units, drawn
+    // `scale` pixels per unit around (centerX, centerY)
+    void Draw(SoftCanvas &canvas, float centerX, float centerY, const EyeConfig &cfg, float scale, Color color, const SoftRect *clip = nullptr) {
+        int x, y;
+        const EyeSprite &sprite = Get(EyeSpriteKeyFor(cfg, centerX, centerY, scale, x, y));
+        SoftBlitMask(canvas, sprite.mask, x + sprite.originX, y + sprite.originY, color, clip);
+    }
+
+    // Both eyes as EyeDrawer::DrawPair lays them out, spacing in design units
+    void DrawPair(SoftCanvas &canvas, float centerX, float centerY, float spacing, const EyeConfig &cfg, float scale, Color color,
+                  const SoftRect *clip = nullptr) {
+        Draw(canvas, centerX - spacing * scale, centerY, cfg, scale, color, clip);
+        Draw(canvas, centerX + spacing * scale, centerY, EyeConfigRight(cfg), scale, color, clip);
+    }
+
+private:
+    static void Render(EyeSprite &sprite, const EyeSpriteKey &key) {
+        EyeConfig cfg = EyeSpriteConfig(key);
+        Vector2 outline[4 * (ARC_TABLE_MAX_SEGMENTS + 1)];
+        int count = EyeOutline(cfg, 0.0f, 0.0f, 0, outline);
+        float minX = outline[0].x, maxX = outline[0].x, minY = outline[0].y, maxY = outline[0].y;
+        for (int i = 1; i < count; i++) {
+            minX = fminf(minX, outline[i].x); maxX = fmaxf(maxX, outline[i].x);
+            minY = fminf(minY, outline[i].y); maxY = fmaxf(maxY, outline[i].y);
+        }
+
+        sprite.key = key;
+        sprite.originX = (int)floorf(minX);
+        sprite.originY = (int)floorf(minY);
+        sprite.mask.Resize((int)ceilf(maxX) - sprite.originX + 1, (int)ceilf(maxY) - sprite.originY + 1, SOFT_GRAY8);
+        SoftDrawEye(sprite.mask, (float)-sprite.originX, (float)-sprite.originY, cfg, Color{ 255, 255, 255, 255 });
+        sprite.bytes = sprite.mask.pixels.size() + sizeof(EyeSprite);
+    }
+
+    // Oldest first, but never `keep` (the sprite about to be handed out; -1 for none)
+    void Trim(int keep) {
+        while (stats.bytes > budget && tail >= 0 && tail != keep) {
+            int slot = tail;
+            EyeSprite &sprite = sprites[slot];
+            Unlink(slot);
+            index.erase(sprite.key);
+            stats.bytes -= sprite.bytes;
+            stats.sprites--;
+            stats.evictions++;
+            sprite.mask = SoftCanvas();
+            sprite.bytes = 0;
+            free.push_back(slot);
+        }
+    }
+
+    void Unlink(int slot) {
+        EyeSprite &s = sprites[slot];
+        if (s.prev >= 0) sprites[s.prev].next = s.next;
+        else head = s.next;
+        if (s.next >= 0) sprites[s.next].prev = s.prev;
+        else tail = s.prev;
+        s.prev = s.next = -1;
+    }
+
+    void PushFront(int slot) {
+        sprites[slot].next = head;
+        if (head >= 0) sprites[head].prev = slot;
+        head = slot;
+        if (tail < 0) tail = slot;
+    }
+
+    size_t budget;
+    std::unordered_map<EyeSpriteKey, int, EyeSpriteKeyHash> index;
+    std::vector<EyeSprite> sprites;
+    std::vector<int> free; // slots of evicted sprites
+    EyeSprite scratch;     // next sprite being rendered, or the last one too big to cache
+    int head = -1, tail = -1;
+    EyeSpriteCacheStats stats;
+};
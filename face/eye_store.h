@@ -0,0 +1,413 @@
+#pragma once
+#include "eye_blend.h"
+#include "eye_config.h"
+#include "raylib_types.h"
+#include "simd_dispatch.h"
+#include <math.h>
+#include <new>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// --- EyeConfigStore ---
+// Many faces as one column per field instead of an array of EyeConfig (eight floats and
+// four bools, padded to 36 bytes) or ShapeConfig (four more floats of colour that get
+// cast to bytes on every draw):
+//   floats  EYE_FIELD_COUNT columns back to back in one 64-byte aligned block
+//   flags   one bitset per flag, 64 faces per word
+//   colours RGBA8, ready to hand to raylib
+// Columns are `Stride()` long, a multiple of EYE_STORE_LANES, so a per-frame pass runs
+// whole aligned vectors from the first face to the last with no tail loop. Padding
+// faces hold zeros and are never read back by Gather.
+#define EYE_STORE_ALIGN 64
+#define EYE_STORE_LANES 16 // floats per cache line
+
+// Allocator for std::vector with cache-line aligned storage
+template <typename T>
+struct EyeAlignedAllocator {
+    typedef T value_type;
+    EyeAlignedAllocator() = default;
+    template <typename U> EyeAlignedAllocator(const EyeAlignedAllocator<U> &) {}
+
+    T *allocate(size_t n) { return (T *)::operator new(n * sizeof(T), std::align_val_t(EYE_STORE_ALIGN)); }
+    void deallocate(T *p, size_t) { ::operator delete(p, std::align_val_t(EYE_STORE_ALIGN)); }
+
+    template <typename U> bool operator==(const EyeAlignedAllocator<U> &) const { return true; }
+    template <typename U> bool operator!=(const EyeAlignedAllocator<U> &) const { return false; }
+};
+
+template <typename T>
+using EyeAlignedVector = std::vector<T, EyeAlignedAllocator<T>>;
+
+// EyeConfig flags in struct order
+enum EyeFlag {
+    EYE_FLAG_INVERSE_RADIUS_TOP = 0,
+    EYE_FLAG_INVERSE_RADIUS_BOTTOM,
+    EYE_FLAG_INVERSE_OFFSET_TOP,
+    EYE_FLAG_INVERSE_OFFSET_BOTTOM,
+    EYE_FLAG_COUNT
+};
+
+class EyeConfigStore {
+public:
+    // n faces, zeroed, opaque white
+    void Resize(int n) {
+        count = n;
+        stride = (n + EYE_STORE_LANES - 1) / EYE_STORE_LANES * EYE_STORE_LANES;
+        words = (stride + 63) / 64;
+        floats.assign((size_t)EYE_FIELD_COUNT * stride, 0.0f);
+        flagBits.assign((size_t)EYE_FLAG_COUNT * words, 0);
+        scratchBits.assign(words, 0);
+        colors.assign(stride, Color{ 255, 255, 255, 255 });
+    }
+
+    int Count() const { return count; }
+    int Stride() const { return stride; }
+    int FlagWords() const { return words; }
+
+    // Whole columns; field k of face i is Field(k)[i]
+    float *Field(EyeField field) { return floats.data() + (size_t)field * stride; }
+    const float *Field(EyeField field) const { return floats.data() + (size_t)field * stride; }
+    uint64_t *FlagBits(EyeFlag flag) { return flagBits.data() + (size_t)flag * words; }
+    const uint64_t *FlagBits(EyeFlag flag) const { return flagBits.data() + (size_t)flag * words; }
+    Color *Colors() { return colors.data(); }
+    const Color *Colors() const { return colors.data(); }
+
+    // FlagWords() words of per-pass scratch, for passes that write this store (EyeStoreLerp)
+    uint64_t *ScratchBits() { return scratchBits.data(); }
+
+    bool Flag(EyeFlag flag, int i) const { return (FlagBits(flag)[i >> 6] >> (i & 63)) & 1; }
+    void SetFlag(EyeFlag flag, int i, bool on) {
+        uint64_t &word = FlagBits(flag)[i >> 6];
+        word = (word & ~(1ull << (i & 63))) | (uint64_t)on << (i & 63);
+    }
+
+    // --- One face ---
+    void Set(int i, const EyeConfig &cfg) {
+        const float *src = &cfg.OffsetX;
+        for (int k = 0; k < EYE_FIELD_COUNT; k++) floats[(size_t)k * stride + i] = src[k];
+        const bool *f = &cfg.Inverse_Radius_Top;
+        for (int k = 0; k < EYE_FLAG_COUNT; k++) SetFlag((EyeFlag)k, i, f[k]);
+    }
+
+    EyeConfig Get(int i) const {
+        EyeConfig cfg;
+        float *dst = &cfg.OffsetX;
+        for (int k = 0; k < EYE_FIELD_COUNT; k++) dst[k] = floats[(size_t)k * stride + i];
+        bool *f = &cfg.Inverse_Radius_Top;
+        for (int k = 0; k < EYE_FLAG_COUNT; k++) f[k] = Flag((EyeFlag)k, i);
+        return cfg;
+    }
+
+    // --- Scatter / gather ---
+    // EyeConfigStore::Scatter: Faces [first, first + n) from an EyeConfig array
+    void Scatter(const EyeConfig *src, int first, int n, SimdLevel level = DetectSimdLevel()) {
+        int done = 0, flagsDone = 0;
+#if FACE_SIMD_X86
+        if (level >= SIMD_AVX2) done = flagsDone = ScatterAVX2(src, first, n);
+        else if (level >= SIMD_SSE2) done = ScatterSSE2(src, first, n);
+#else
+        (void)level;
+#endif
+        for (int j = done; j < n; j++) {
+            const float *s = &src[j].OffsetX;
+            for (int k = 0; k < EYE_FIELD_COUNT; k++) floats[(size_t)k * stride + first + j] = s[k];
+        }
+        ScatterFlags(&src[flagsDone].Inverse_Radius_Top, sizeof(EyeConfig), first + flagsDone, n - flagsDone);
+    }
+
+    // EyeConfigStore::Gather: Faces [first, first + n) back into an EyeConfig array
+    void Gather(EyeConfig *dst, int first, int n, SimdLevel level = DetectSimdLevel()) const {
+        int done = 0, flagsDone = 0;
+#if FACE_SIMD_X86
+        if (level >= SIMD_AVX2) done = flagsDone = GatherAVX2(dst, first, n);
+        else if (level >= SIMD_SSE2) done = GatherSSE2(dst, first, n);
+#else
+        (void)level;
+#endif
+        for (int j = done; j < n; j++) {
+            float *d = &dst[j].OffsetX;
+            for (int k = 0; k < EYE_FIELD_COUNT; k++) d[k] = floats[(size_t)k * stride + first + j];
+        }
+        GatherFlags(&dst[flagsDone].Inverse_Radius_Top, sizeof(EyeConfig), first + flagsDone, n - flagsDone);
+    }
+
+    // Shape-style structs (Basic_0's ShapeConfig): the EyeConfig floats, then R, G, B, A
+    // as 0-255 floats, then the four flags. Colours are packed once here, not per draw.
+    template <typename Shape>
+    void ScatterShapes(const Shape *src, int first, int n) {
+        for (int j = 0; j < n; j++) {
+            const Shape &s = src[j];
+            const float geometry[EYE_FIELD_COUNT] = { s.OffsetX, s.OffsetY, s.Height, s.Width, s.Slope_Top, s.Slope_Bottom, s.Radius_Top, s.Radius_Bottom };
+            for (int k = 0; k < EYE_FIELD_COUNT; k++) floats[(size_t)k * stride + first + j] = geometry[k];
+            colors[first + j] = Color{ PackChannel(s.R), PackChannel(s.G), PackChannel(s.B), PackChannel(s.A) };
+        }
+        ScatterFlags(&src->Inverse_Radius_Top, sizeof(Shape), first, n);
+    }
+
+    template <typename Shape>
+    void GatherShapes(Shape *dst, int first, int n) const {
+        for (int j = 0; j < n; j++) {
+            Shape &s = dst[j];
+            int i = first + j;
+            s.OffsetX = Field(EYE_FIELD_OFFSET_X)[i];         s.OffsetY = Field(EYE_FIELD_OFFSET_Y)[i];
+            s.Height = Field(EYE_FIELD_HEIGHT)[i];            s.Width = Field(EYE_FIELD_WIDTH)[i];
+            s.Slope_Top = Field(EYE_FIELD_SLOPE_TOP)[i];      s.Slope_Bottom = Field(EYE_FIELD_SLOPE_BOTTOM)[i];
+            s.Radius_Top = Field(EYE_FIELD_RADIUS_TOP)[i];    s.Radius_Bottom = Field(EYE_FIELD_RADIUS_BOTTOM)[i];
+            s.R = colors[i].r;  s.G = colors[i].g;  s.B = colors[i].b;  s.A = colors[i].a;
+        }
+        GatherFlags(&dst->Inverse_Radius_Top, sizeof(Shape), first, n);
+    }
+
+private:
+    static unsigned char PackChannel(float v) { return (unsigned char)(fminf(fmaxf(v, 0.0f), 255.0f) + 0.5f); }
+
+    // The four flag bools sit together in both structs; `flags` points at the first
+    // one of face 0 and `size` steps to the next face. Each face's four bools are read as
+    // one word and whole bitset words are built in registers, then written once.
+    void ScatterFlags(const bool *flags, size_t size, int first, int n) {
+        const unsigned char *p = (const unsigned char *)flags;
+        int i = first, end = first + n;
+        while (i < end) {
+            int stop = (i | 63) + 1 < end ? (i | 63) + 1 : end;
+            uint64_t w0 = 0, w1 = 0, w2 = 0, w3 = 0, mask = 0;
+            for (int b = i; b < stop; b++, p += size) {
+                uint32_t four;
+                memcpy(&four, p, 4);
+                uint64_t bit = 1ull << (b & 63);
+                w0 |= (four & 0x00000001u) ? bit : 0;
+                w1 |= (four & 0x00000100u) ? bit : 0;
+                w2 |= (four & 0x00010000u) ? bit : 0;
+                w3 |= (four & 0x01000000u) ? bit : 0;
+                mask |= bit;
+            }
+            const uint64_t word[EYE_FLAG_COUNT] = { w0, w1, w2, w3 };
+            for (int k = 0; k < EYE_FLAG_COUNT; k++) {
+                uint64_t &bits = FlagBits((EyeFlag)k)[i >> 6];
+                bits = (bits & ~mask) | word[k];
+            }
+            i = stop;
+        }
+    }
+
+    void GatherFlags(bool *flags, size_t size, int first, int n) const {
+        unsigned char *p = (unsigned char *)flags;
+        const uint64_t *f0 = FlagBits(EYE_FLAG_INVERSE_RADIUS_TOP), *f1 = FlagBits(EYE_FLAG_INVERSE_RADIUS_BOTTOM);
+        const uint64_t *f2 = FlagBits(EYE_FLAG_INVERSE_OFFSET_TOP), *f3 = FlagBits(EYE_FLAG_INVERSE_OFFSET_BOTTOM);
+        for (int i = first; i < first + n; i++, p += size) {
+            int w = i >> 6, b = i & 63;
+            uint32_t four = (uint32_t)((f0[w] >> b) & 1) | (uint32_t)((f1[w] >> b) & 1) << 8 |
+                            (uint32_t)((f2[w] >> b) & 1) << 16 | (uint32_t)((f3[w] >> b) & 1) << 24;
+            memcpy(p, &four, 4);
+        }
+    }
+
+    // Eight flags of one kind starting at face i, which may straddle two words
+    uint32_t FlagByte(EyeFlag flag, int i) const {
+        const uint64_t *w = FlagBits(flag) + (i >> 6);
+        int b = i & 63;
+        uint64_t bits = w[0] >> b;
+        if (b > 56) bits |= w[1] << (64 - b);
+        return (uint32_t)bits & 0xFF;
+    }
+
+    void SetFlagByte(EyeFlag flag, int i, uint32_t byte) {
+        uint64_t *w = FlagBits(flag) + (i >> 6);
+        int b = i & 63;
+        w[0] = (w[0] & ~(0xFFull << b)) | (uint64_t)byte << b;
+        if (b > 56) w[1] = (w[1] & ~(0xFFull >> (64 - b))) | (uint64_t)byte >> (64 - b);
+    }
+
+#if FACE_SIMD_X86
+    // SSE2: 4 faces, fields 0-3 and 4-7 as two 4x4 transposes
+    int ScatterSSE2(const EyeConfig *src, int first, int n) {
+        int j = 0;
+        for (; j + 4 <= n; j += 4) {
+            __m128 lo[4], hi[4];
+            for (int r = 0; r < 4; r++) {
+                lo[r] = _mm_loadu_ps(&src[j + r].OffsetX);
+                hi[r] = _mm_loadu_ps(&src[j + r].OffsetX + 4);
+            }
+            _MM_TRANSPOSE4_PS(lo[0], lo[1], lo[2], lo[3]);
+            _MM_TRANSPOSE4_PS(hi[0], hi[1], hi[2], hi[3]);
+            for (int k = 0; k < 4; k++) {
+                _mm_storeu_ps(&floats[(size_t)k * stride + first + j], lo[k]);
+                _mm_storeu_ps(&floats[(size_t)(k + 4) * stride + first + j], hi[k]);
+            }
+        }
+        return j;
+    }
+
+    int GatherSSE2(EyeConfig *dst, int first, int n) const {
+        int j = 0;
+        for (; j + 4 <= n; j += 4) {
+            __m128 lo[4], hi[4];
+            for (int k = 0; k < 4; k++) {
+                lo[k] = _mm_loadu_ps(&floats[(size_t)k * stride + first + j]);
+                hi[k] = _mm_loadu_ps(&floats[(size_t)(k + 4) * stride + first + j]);
+            }
+            _MM_TRANSPOSE4_PS(lo[0], lo[1], lo[2], lo[3]);
+            _MM_TRANSPOSE4_PS(hi[0], hi[1], hi[2], hi[3]);
+            for (int r = 0; r < 4; r++) {
+                _mm_storeu_ps(&dst[j + r].OffsetX, lo[r]);
+                _mm_storeu_ps(&dst[j + r].OffsetX + 4, hi[r]);
+            }
+        }
+        return j;
+    }
+
+    // AVX2: 8 faces x 8 fields is one square 8x8 transpose either way
+    FACE_TARGET_AVX2 static void Transpose8(__m256 *r) {
+        __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]), t1 = _mm256_unpackhi_ps(r[0], r[1]);
+        __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]), t3 = _mm256_unpackhi_ps(r[2], r[3]);
+        __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]), t5 = _mm256_unpackhi_ps(r[4], r[5]);
+        __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]), t7 = _mm256_unpackhi_ps(r[6], r[7]);
+        __m256 s0 = _mm256_shuffle_ps(t0, t2, 0x44), s1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+        __m256 s2 = _mm256_shuffle_ps(t1, t3, 0x44), s3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+        __m256 s4 = _mm256_shuffle_ps(t4, t6, 0x44), s5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+        __m256 s6 = _mm256_shuffle_ps(t5, t7, 0x44), s7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+        r[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+        r[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+        r[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+        r[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+        r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+        r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+        r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+        r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+    }
+
+    // Flags too: the four bools of 8 faces are one gather of 32-bit words, and each
+    // flag's 8 bits come out of a shift and a movemask
+    FACE_TARGET_AVX2 int ScatterAVX2(const EyeConfig *src, int first, int n) {
+        const int words = sizeof(EyeConfig) / 4;
+        const __m256i index = _mm256_setr_epi32(0, words, 2 * words, 3 * words, 4 * words, 5 * words, 6 * words, 7 * words);
+        int j = 0;
+        for (; j + 8 <= n; j += 8) {
+            __m256 r[8];
+            for (int f = 0; f < 8; f++) r[f] = _mm256_loadu_ps(&src[j + f].OffsetX);
+            Transpose8(r);
+            for (int k = 0; k < EYE_FIELD_COUNT; k++) _mm256_storeu_ps(&floats[(size_t)k * stride + first + j], r[k]);
+
+            __m256i four = _mm256_i32gather_epi32((const int *)&src[j].Inverse_Radius_Top, index, 4);
+            SetFlagByte(EYE_FLAG_INVERSE_RADIUS_TOP, first + j, _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(four, 31))));
+            SetFlagByte(EYE_FLAG_INVERSE_RADIUS_BOTTOM, first + j, _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(four, 23))));
+            SetFlagByte(EYE_FLAG_INVERSE_OFFSET_TOP, first + j, _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(four, 15))));
+            SetFlagByte(EYE_FLAG_INVERSE_OFFSET_BOTTOM, first + j, _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(four, 7))));
+        }
+        return j;
+    }
+
+    FACE_TARGET_AVX2 int GatherAVX2(EyeConfig *dst, int first, int n) const {
+        const __m256i lane = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        int j = 0;
+        for (; j + 8 <= n; j += 8) {
+            __m256 r[8];
+            for (int k = 0; k < EYE_FIELD_COUNT; k++) r[k] = _mm256_loadu_ps(&floats[(size_t)k * stride + first + j]);
+            Transpose8(r);
+            for (int f = 0; f < 8; f++) _mm256_storeu_ps(&dst[j + f].OffsetX, r[f]);
+
+            // Lane f gets bit f of each flag byte, moved to that flag's bool
+            __m256i four = _mm256_setzero_si256();
+            for (int k = 0; k < EYE_FLAG_COUNT; k++) {
+                __m256i set = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(FlagByte((EyeFlag)k, first + j)), lane), lane);
+                four = _mm256_or_si256(four, _mm256_and_si256(set, _mm256_set1_epi32(1 << (8 * k))));
+            }
+            uint32_t out[8];
+            _mm256_storeu_si256((__m256i *)out, four);
+            for (int f = 0; f < 8; f++) memcpy(&dst[j + f].Inverse_Radius_Top, &out[f], 4);
+        }
+        return j;
+    }
+#endif
+
+    int count = 0;
+    int stride = 0; // faces rounded up to EYE_STORE_LANES
+    int words = 0;  // 64-bit words per flag bitset
+    EyeAlignedVector<float> floats;     // EYE_FIELD_COUNT columns of `stride`
+    EyeAlignedVector<uint64_t> flagBits; // EYE_FLAG_COUNT bitsets of `words`
+    EyeAlignedVector<uint64_t> scratchBits; // `words`
+    EyeAlignedVector<Color> colors;      // `stride`, RGBA8
+};
+
+// --- Per-frame passes ---
+// EyeStoreLerp: out = from + (to - from) * t per face for the fields in `fields`, each
+// column one flat run of aligned vectors; untouched columns cost nothing. Flags switch
+// to `to` where t >= 0.5, 64 faces per word. t holds Stride() weights; out may alias
+// from or to. late receives the t >= 0.5 bits, FlagWords() words; EyeStoreLerp keeps them
+// in out's scratch, so lerps into different stores can run on different threads.
+inline void EyeStoreLerpScalar(const float *from, const float *to, const float *t, float *out, int stride, uint32_t fields, uint64_t *late) {
+    for (int k = 0; k < EYE_FIELD_COUNT; k++) {
+        if (!(fields & EYE_FIELD_BIT(k))) continue;
+        const float *a = from + (size_t)k * stride, *b = to + (size_t)k * stride;
+        float *o = out + (size_t)k * stride;
+        for (int i = 0; i < stride; i++) o[i] = a[i] + (b[i] - a[i]) * t[i];
+    }
+    for (int i = 0; i < stride; i += 64) {
+        uint64_t word = 0;
+        int bits = stride - i < 64 ? stride - i : 64;
+        for (int b = 0; b < bits; b++) word |= (uint64_t)(t[i + b] >= 0.5f) << b;
+        late[i >> 6] = word;
+    }
+}
+
+#if FACE_SIMD_X86
+inline void EyeStoreLerpSSE2(const float *from, const float *to, const float *t, float *out, int stride, uint32_t fields, uint64_t *late) {
+    for (int k = 0; k < EYE_FIELD_COUNT; k++) {
+        if (!(fields & EYE_FIELD_BIT(k))) continue;
+        const float *a = from + (size_t)k * stride, *b = to + (size_t)k * stride;
+        float *o = out + (size_t)k * stride;
+        for (int i = 0; i < stride; i += 4) {
+            __m128 va = _mm_load_ps(a + i);
+            _mm_store_ps(o + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(b + i), va), _mm_load_ps(t + i))));
+        }
+    }
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (int i = 0; i < stride; i += 64) {
+        uint64_t word = 0;
+        int bits = stride - i < 64 ? stride - i : 64;
+        for (int b = 0; b < bits; b += 4) word |= (uint64_t)_mm_movemask_ps(_mm_cmpge_ps(_mm_load_ps(t + i + b), half)) << b;
+        late[i >> 6] = word;
+    }
+}
+
+FACE_TARGET_AVX2 inline void EyeStoreLerpAVX2(const float *from, const float *to, const float *t, float *out, int stride, uint32_t fields, uint64_t *late) {
+    for (int k = 0; k < EYE_FIELD_COUNT; k++) {
+        if (!(fields & EYE_FIELD_BIT(k))) continue;
+        const float *a = from + (size_t)k * stride, *b = to + (size_t)k * stride;
+        float *o = out + (size_t)k * stride;
+        for (int i = 0; i < stride; i += 8) {
+            __m256 va = _mm256_load_ps(a + i);
+            _mm256_store_ps(o + i, _mm256_fmadd_ps(_mm256_sub_ps(_mm256_load_ps(b + i), va), _mm256_load_ps(t + i), va));
+        }
+    }
+    const __m256 half = _mm256_set1_ps(0.5f);
+    for (int i = 0; i < stride; i += 64) {
+        uint64_t word = 0;
+        int bits = stride - i < 64 ? stride - i : 64;
+        for (int b = 0; b < bits; b += 8) word |= (uint64_t)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_load_ps(t + i + b), half, _CMP_GE_OQ)) << b;
+        late[i >> 6] = word;
+    }
+}
+#endif
+
+inline void EyeStoreLerp(const EyeConfigStore &from, const EyeConfigStore &to, const float *t, EyeConfigStore &out,
+                         uint32_t fields = EYE_FIELDS_ALL, SimdLevel level = DetectSimdLevel()) {
+    uint64_t *late = out.ScratchBits();
+    int stride = out.Stride();
+    const float *a = from.Field(EYE_FIELD_OFFSET_X), *b = to.Field(EYE_FIELD_OFFSET_X);
+    float *o = out.Field(EYE_FIELD_OFFSET_X);
+#if FACE_SIMD_X86
+    if (level >= SIMD_AVX2) EyeStoreLerpAVX2(a, b, t, o, stride, fields, late);
+    else if (level >= SIMD_SSE2) EyeStoreLerpSSE2(a, b, t, o, stride, fields, late);
+    else EyeStoreLerpScalar(a, b, t, o, stride, fields, late);
+#else
+    (void)level;
+    EyeStoreLerpScalar(a, b, t, o, stride, fields, late);
+#endif
+
+    for (int k = 0; k < EYE_FLAG_COUNT; k++) {
+        const uint64_t *f = from.FlagBits((EyeFlag)k), *g = to.FlagBits((EyeFlag)k);
+        uint64_t *dst = out.FlagBits((EyeFlag)k);
+        for (int w = 0; w < out.FlagWords(); w++) dst[w] = (f[w] & ~late[w]) | (g[w] & late[w]);
+    }
+}
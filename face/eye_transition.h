@@ -0,0 +1,192 @@
+#pragma once
+#include "eye_config.h"
+#include "simd_dispatch.h"
+#include <stddef.h>
+#include <vector>
+
+// The eight shape floats lead the struct, so one config is one 256-bit vector
+static_assert(offsetof(EyeConfig, Radius_Bottom) == 7 * sizeof(float), "EyeConfig floats must be contiguous");
+
+// --- Easing ---
+enum EaseType {
+    EASE_LINEAR = 0,
+    EASE_IN_QUAD,
+    EASE_OUT_QUAD,
+    EASE_IN_OUT_QUAD,
+    EASE_IN_OUT_CUBIC,
+    EASE_OUT_BACK,   // overshoots a little, then settles
+    EASE_COUNT
+};
+
+inline float EaseApply(EaseType ease, float t) {
+    if (t <= 0.0f) return 0.0f;
+    if (t >= 1.0f) return 1.0f;
+    switch (ease) {
+        case EASE_IN_QUAD: return t * t;
+        case EASE_OUT_QUAD: return t * (2.0f - t);
+        case EASE_IN_OUT_QUAD: return (t < 0.5f) ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
+        case EASE_IN_OUT_CUBIC: {
+            if (t < 0.5f) return 4.0f * t * t * t;
+            float f = 2.0f * t - 2.0f;
+            return 0.5f * f * f * f + 1.0f;
+        }
+        case EASE_OUT_BACK: {
+            const float s = 1.70158f;
+            float f = t - 1.0f;
+            return f * f * ((s + 1.0f) * f + s) + 1.0f;
+        }
+        default: return t;
+    }
+}
+
+inline const char *EaseName(EaseType ease) {
+    switch (ease) {
+        case EASE_IN_QUAD: return "in quad";
+        case EASE_OUT_QUAD: return "out quad";
+        case EASE_IN_OUT_QUAD: return "in-out quad";
+        case EASE_IN_OUT_CUBIC: return "in-out cubic";
+        case EASE_OUT_BACK: return "out back";
+        default: return "linear";
+    }
+}
+
+// --- Interpolation ---
+// Flags can't be blended; they switch to the target's halfway through
+inline void EyeConfigLerpFlags(const EyeConfig &from, const EyeConfig &to, float t, EyeConfig &out) {
+    const EyeConfig &src = (t < 0.5f) ? from : to;
+    out.Inverse_Radius_Top = src.Inverse_Radius_Top;
+    out.Inverse_Radius_Bottom = src.Inverse_Radius_Bottom;
+    out.Inverse_Offset_Top = src.Inverse_Offset_Top;
+    out.Inverse_Offset_Bottom = src.Inverse_Offset_Bottom;
+}
+
+// Scalar kernel, also used for the tail the vector kernels leave over
+inline void EyeConfigLerpScalar(const EyeConfig *from, const EyeConfig *to, const float *t, EyeConfig *out, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+        const float *a = &from[i].OffsetX, *b = &to[i].OffsetX;
+        float *o = &out[i].OffsetX;
+        for (int k = 0; k < 8; k++) o[k] = a[k] + (b[k] - a[k]) * t[i];
+        EyeConfigLerpFlags(from[i], to[i], t[i], out[i]);
+    }
+}
+
+#if FACE_SIMD_X86
+// SSE2 kernel: one config as two 4-float halves
+inline int EyeConfigLerpSSE2(const EyeConfig *from, const EyeConfig *to, const float *t, EyeConfig *out, int count) {
+    for (int i = 0; i < count; i++) {
+        __m128 vt = _mm_set1_ps(t[i]);
+        for (int h = 0; h < 8; h += 4) {
+            __m128 a = _mm_loadu_ps(&from[i].OffsetX + h);
+            __m128 b = _mm_loadu_ps(&to[i].OffsetX + h);
+            _mm_storeu_ps(&out[i].OffsetX + h, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), vt)));
+        }
+        EyeConfigLerpFlags(from[i], to[i], t[i], out[i]);
+    }
+    return count;
+}
+
+// AVX2 kernel: one config per 256-bit FMA
+FACE_TARGET_AVX2 inline int EyeConfigLerpAVX2(const EyeConfig *from, const EyeConfig *to, const float *t, EyeConfig *out, int count) {
+    for (int i = 0; i < count; i++) {
+        __m256 a = _mm256_loadu_ps(&from[i].OffsetX);
+        __m256 b = _mm256_loadu_ps(&to[i].OffsetX);
+        _mm256_storeu_ps(&out[i].OffsetX, _mm256_fmadd_ps(_mm256_sub_ps(b, a), _mm256_set1_ps(t[i]), a));
+        EyeConfigLerpFlags(from[i], to[i], t[i], out[i]);
+    }
+    return count;
+}
+#endif
+
+// EyeConfigLerpBatch: out[i] = from[i] + (to[i] - from[i]) * t[i] for every shape float.
+// out may alias from or to.
+inline void EyeConfigLerpBatch(const EyeConfig *from, const EyeConfig *to, const float *t, EyeConfig *out, int count, SimdLevel level = DetectSimdLevel()) {
+    int done = 0;
+#if FACE_SIMD_X86
+    if (level >= SIMD_AVX2) done = EyeConfigLerpAVX2(from, to, t, out, count);
+    else if (level >= SIMD_SSE2) done = EyeConfigLerpSSE2(from, to, t, out, count);
+#else
+    (void)level;
+#endif
+    EyeConfigLerpScalar(from, to, t, out, done, count);
+}
+
+inline EyeConfig EyeConfigLerp(const EyeConfig &from, const EyeConfig &to, float t) {
+    EyeConfig out;
+    EyeConfigLerpBatch(&from, &to, &t, &out, 1);
+    return out;
+}
+
+// --- EyeTransition ---
+// One face blending towards a target. Starting a new transition mid-way begins from
+// wherever the face currently is, so interrupted expressions never jump.
+struct EyeTransition {
+    EyeConfig from = Preset_Neutral;
+    EyeConfig to = Preset_Neutral;
+    float duration = 0.0f;
+    float elapsed = 0.0f;
+    EaseType ease = EASE_LINEAR;
+
+    void Start(const EyeConfig &target, float seconds, EaseType easeType) {
+        from = Current();
+        to = target;
+        duration = seconds;
+        elapsed = 0.0f;
+        ease = easeType;
+    }
+
+    // Jump straight to a config, no blending
+    void Set(const EyeConfig &cfg) {
+        from = to = cfg;
+        duration = elapsed = 0.0f;
+    }
+
+    bool Done() const { return elapsed >= duration; }
+
+    EyeConfig Current() const {
+        if (Done()) return to;
+        return EyeConfigLerp(from, to, EaseApply(ease, elapsed / duration));
+    }
+
+    EyeConfig Update(float dt) {
+        elapsed += dt;
+        return Current();
+    }
+};
+
+// --- EyeTransitionBatch ---
+// Thousands of independent transitions sharing one clock. Evaluate eases each eye's
+// progress, then blends all configs in one EyeConfigLerpBatch pass.
+struct EyeTransitionBatch {
+    std::vector<EyeConfig> from, to;
+    std::vector<float> startTime, duration;
+    std::vector<EaseType> ease;
+    std::vector<float> progress; // scratch for Evaluate
+
+    int Count() const { return (int)from.size(); }
+
+    void Resize(int n, const EyeConfig &cfg) {
+        from.assign(n, cfg);
+        to.assign(n, cfg);
+        startTime.assign(n, 0.0f);
+        duration.assign(n, 0.0f);
+        ease.assign(n, EASE_LINEAR);
+        progress.resize(n);
+    }
+
+    // Retargets eye i; `current` is where it is now (usually the last Evaluate output)
+    void Start(int i, const EyeConfig &current, const EyeConfig &target, float now, float seconds, EaseType easeType) {
+        from[i] = current;
+        to[i] = target;
+        startTime[i] = now;
+        duration[i] = seconds;
+        ease[i] = easeType;
+    }
+
+    void Evaluate(float now, EyeConfig *out, SimdLevel level = DetectSimdLevel()) {
+        int n = Count();
+        for (int i = 0; i < n; i++) {
+            progress[i] = (duration[i] > 0.0f) ? EaseApply(ease[i], (now - startTime[i]) / duration[i]) : 1.0f;
+        }
+        EyeConfigLerpBatch(from.data(), to.data(), progress.data(), out, n, level);
+    }
+};
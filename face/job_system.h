@@ -0,0 +1,231 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+// --- JobSystem ---
+// Work-stealing scheduler for per-frame data-parallel work. Every thread owns a deque
+// of index ranges (slot 0 belongs to the thread that dispatches, normally the main
+// thread). A thread runs a range by splitting off its upper half onto its own deque
+// until it is down to `grain` items, then runs that chunk; idle threads steal the
+// oldest, largest ranges from the top of someone else's deque. Splitting happens only
+// as fast as there are thieves, so big uneven workloads balance without a shared
+// counter every thread hammers.
+//
+// Dispatch starts a group and returns at once, so the main thread can keep submitting
+// draws while workers build the next frame; Wait joins it, running jobs meanwhile.
+// Workers spin while any group is in flight and sleep between frames.
+// Only one thread outside the pool may dispatch; jobs may dispatch nested groups.
+
+// One batch of work: fn(begin, end) over [0, count) in chunks of at most `grain`
+struct JobGroup {
+    std::function<void(int, int)> fn;
+    int grain = 1;
+    std::atomic<int> remaining{ 0 }; // items not yet run
+
+    bool Done() const { return remaining.load(std::memory_order_acquire) == 0; }
+};
+
+// Chase-Lev deque of ranges. The owner pushes and pops at the bottom, thieves take from
+// the top; a slot is two atomics, so a thief reading a slot the owner is reusing sees a
+// stale value and then fails its CAS instead of racing.
+class JobDeque {
+public:
+    struct Range {
+        JobGroup *group;
+        int begin, end;
+    };
+
+    // False when full; the caller then runs the range itself
+    bool Push(const Range &r) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= Capacity) return false;
+        Slot &s = slots[b & (Capacity - 1)];
+        s.group.store(r.group, std::memory_order_relaxed);
+        s.range.store((uint64_t)(uint32_t)r.begin | (uint64_t)(uint32_t)r.end << 32, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_release); // publishes the slot and the group
+        return true;
+    }
+
+    bool Pop(Range &r) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        Load(b, r);
+        if (t == b) {
+            // Last item: race any thief for it
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    bool Steal(Range &r) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) return false;
+        Load(t, r);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+private:
+    // Splitting keeps at most log2(count / grain) ranges per deque
+    static const int Capacity = 256;
+
+    struct Slot {
+        std::atomic<JobGroup *> group{ nullptr };
+        std::atomic<uint64_t> range{ 0 };
+    };
+
+    void Load(int64_t i, Range &r) const {
+        const Slot &s = slots[i & (Capacity - 1)];
+        r.group = s.group.load(std::memory_order_relaxed);
+        uint64_t packed = s.range.load(std::memory_order_relaxed);
+        r.begin = (int)(uint32_t)packed;
+        r.end = (int)(uint32_t)(packed >> 32);
+    }
+
+    alignas(64) std::atomic<int64_t> top{ 0 };
+    alignas(64) std::atomic<int64_t> bottom{ 0 };
+    Slot slots[Capacity];
+};
+
+// Which JobSystem thread, if any, the calling thread is
+struct JobThreadSlot {
+    const void *system = nullptr;
+    int index = 0;
+};
+
+inline JobThreadSlot &JobCurrentThread() {
+    static thread_local JobThreadSlot slot;
+    return slot;
+}
+
+class JobSystem {
+public:
+    // threads <= 0: one per hardware thread, the dispatching thread included
+    explicit JobSystem(int threads = 0) {
+        if (threads <= 0) threads = (int)std::thread::hardware_concurrency();
+        if (threads < 1) threads = 1;
+        deques = std::vector<JobDeque>(threads);
+        for (int i = 1; i < threads; i++) workers.emplace_back([this, i] { WorkerLoop(i); });
+    }
+
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &t : workers) t.join();
+    }
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    int Threads() const { return (int)deques.size(); }
+
+    // Index of the calling thread in [0, Threads()), for per-thread scratch
+    int ThreadIndex() const {
+        const JobThreadSlot &slot = JobCurrentThread();
+        return slot.system == this ? slot.index : 0;
+    }
+
+    // JobSystem::Dispatch: Starts fn(begin, end) over [0, count) and returns at once.
+    // group, and everything fn uses, must stay alive until Wait(group) returns.
+    void Dispatch(JobGroup &group, int count, int grain, std::function<void(int, int)> fn) {
+        group.fn = std::move(fn);
+        group.grain = grain < 1 ? 1 : grain;
+        group.remaining.store(count > 0 ? count : 0, std::memory_order_relaxed);
+        if (count <= 0) return;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            active.fetch_add(1, std::memory_order_relaxed);
+        }
+        int self = ThreadIndex();
+        if (!deques[self].Push(JobDeque::Range{ &group, 0, count })) Run(JobDeque::Range{ &group, 0, count }, self);
+        wake.notify_all();
+    }
+
+    // JobSystem::Wait: Runs jobs, its own first, until the group is done
+    void Wait(JobGroup &group) {
+        int self = ThreadIndex();
+        while (!group.Done()) {
+            if (!RunOne(self)) std::this_thread::yield();
+        }
+    }
+
+    void ParallelFor(int count, int grain, std::function<void(int, int)> fn) {
+        JobGroup group;
+        Dispatch(group, count, grain, std::move(fn));
+        Wait(group);
+    }
+
+private:
+    // Halves stay behind for thieves until the range is one chunk, then it runs
+    void Run(JobDeque::Range r, int self) {
+        JobGroup *group = r.group;
+        while (r.end - r.begin > group->grain) {
+            int mid = r.begin + (r.end - r.begin) / 2;
+            if (!deques[self].Push(JobDeque::Range{ group, mid, r.end })) break;
+            r.end = mid;
+        }
+        group->fn(r.begin, r.end);
+        // Nothing may touch the group after the last items are counted: the waiter
+        // is free to destroy it
+        if (group->remaining.fetch_sub(r.end - r.begin, std::memory_order_acq_rel) == r.end - r.begin) {
+            active.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    // Own deque first, then steal, starting from the next thread round
+    bool RunOne(int self) {
+        JobDeque::Range r;
+        if (deques[self].Pop(r)) {
+            Run(r, self);
+            return true;
+        }
+        int n = (int)deques.size();
+        for (int k = 1; k < n; k++) {
+            int victim = (self + k) % n;
+            if (deques[victim].Steal(r)) {
+                Run(r, self);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkerLoop(int index) {
+        JobCurrentThread() = JobThreadSlot{ this, index };
+        for (;;) {
+            if (active.load(std::memory_order_acquire) > 0) {
+                if (!RunOne(index)) std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || active.load(std::memory_order_acquire) > 0; });
+            if (stopping) return;
+        }
+    }
+
+    std::vector<JobDeque> deques;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::atomic<int> active{ 0 }; // groups dispatched and not yet done
+    bool stopping = false;
+};
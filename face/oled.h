@@ -0,0 +1,101 @@
+#pragma once
+#include "simd_dispatch.h"
+#include "soft_raster.h"
+#include <stdint.h>
+
+// --- 1-bpp OLED frames ---
+// SSD1306-class panels take the screen as 8 horizontal pages of 8 pixel rows: byte
+// [page * OLED_WIDTH + x] holds column x of the page, bit r = pixel row page * 8 + r.
+#define OLED_WIDTH 128
+#define OLED_HEIGHT 64
+#define OLED_PAGES (OLED_HEIGHT / 8)
+#define OLED_FRAME_BYTES (OLED_WIDTH * OLED_PAGES)
+
+struct OledFrame {
+    uint8_t bytes[OLED_FRAME_BYTES];
+
+    bool Pixel(int x, int y) const { return (bytes[(y / 8) * OLED_WIDTH + x] >> (y % 8)) & 1; }
+};
+
+// Scalar kernel: a pixel is lit when its gray value is above threshold
+inline void OledEncodeScalar(const uint8_t *gray, int stride, uint8_t threshold, OledFrame &out) {
+    for (int page = 0; page < OLED_PAGES; page++) {
+        const uint8_t *rows = gray + (size_t)page * 8 * stride;
+        uint8_t *dst = out.bytes + page * OLED_WIDTH;
+        for (int x = 0; x < OLED_WIDTH; x++) {
+            uint8_t bits = 0;
+            for (int r = 0; r < 8; r++) bits |= (uint8_t)((rows[r * stride + x] > threshold) << r);
+            dst[x] = bits;
+        }
+    }
+}
+
+#if FACE_SIMD_X86
+// SSE2 kernel: 16 columns per iteration. There is no unsigned byte compare, so both
+// sides are flipped into signed range with ^ 0x80 first.
+inline void OledEncodeSSE2(const uint8_t *gray, int stride, uint8_t threshold, OledFrame &out) {
+    const __m128i flip = _mm_set1_epi8((char)0x80);
+    const __m128i limit = _mm_set1_epi8((char)(threshold ^ 0x80));
+    for (int page = 0; page < OLED_PAGES; page++) {
+        const uint8_t *rows = gray + (size_t)page * 8 * stride;
+        for (int x = 0; x < OLED_WIDTH; x += 16) {
+            __m128i bits = _mm_setzero_si128();
+            for (int r = 0; r < 8; r++) {
+                __m128i px = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(rows + r * stride + x)), flip);
+                __m128i lit = _mm_cmpgt_epi8(px, limit);
+                bits = _mm_or_si128(bits, _mm_and_si128(lit, _mm_set1_epi8((char)(1 << r))));
+            }
+            _mm_storeu_si128((__m128i *)(out.bytes + page * OLED_WIDTH + x), bits);
+        }
+    }
+}
+
+// AVX2 kernel: 32 columns per iteration
+FACE_TARGET_AVX2 inline void OledEncodeAVX2(const uint8_t *gray, int stride, uint8_t threshold, OledFrame &out) {
+    const __m256i flip = _mm256_set1_epi8((char)0x80);
+    const __m256i limit = _mm256_set1_epi8((char)(threshold ^ 0x80));
+    for (int page = 0; page < OLED_PAGES; page++) {
+        const uint8_t *rows = gray + (size_t)page * 8 * stride;
+        for (int x = 0; x < OLED_WIDTH; x += 32) {
+            __m256i bits = _mm256_setzero_si256();
+            for (int r = 0; r < 8; r++) {
+                __m256i px = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(rows + r * stride + x)), flip);
+                __m256i lit = _mm256_cmpgt_epi8(px, limit);
+                bits = _mm256_or_si256(bits, _mm256_and_si256(lit, _mm256_set1_epi8((char)(1 << r))));
+            }
+            _mm256_storeu_si256((__m256i *)(out.bytes + page * OLED_WIDTH + x), bits);
+        }
+    }
+}
+#endif
+
+// OledEncode: Thresholds a 128x64 GRAY8 image (rows `stride` bytes apart) into a panel frame
+inline void OledEncode(const uint8_t *gray, int stride, uint8_t threshold, OledFrame &out, SimdLevel level = DetectSimdLevel()) {
+#if FACE_SIMD_X86
+    if (level >= SIMD_AVX2) { OledEncodeAVX2(gray, stride, threshold, out); return; }
+    if (level >= SIMD_SSE2) { OledEncodeSSE2(gray, stride, threshold, out); return; }
+#else
+    (void)level;
+#endif
+    OledEncodeScalar(gray, stride, threshold, out);
+}
+
+// OledEncodeCanvas: Same from a SoftCanvas of at least 128x64 (top-left corner is used).
+// RGBA8 canvases go through their luma first; render in GRAY8 to skip that step.
+// Returns false if the canvas is too small.
+inline bool OledEncodeCanvas(const SoftCanvas &canvas, uint8_t threshold, OledFrame &out, SimdLevel level = DetectSimdLevel()) {
+    if (canvas.width < OLED_WIDTH || canvas.height < OLED_HEIGHT) return false;
+    if (canvas.format == SOFT_GRAY8) {
+        OledEncode(canvas.pixels.data(), canvas.Stride(), threshold, out, level);
+        return true;
+    }
+    uint8_t gray[OLED_WIDTH * OLED_HEIGHT];
+    for (int y = 0; y < OLED_HEIGHT; y++) {
+        const unsigned char *src = canvas.pixels.data() + (size_t)y * canvas.Stride();
+        for (int x = 0; x < OLED_WIDTH; x++, src += 4) {
+            gray[y * OLED_WIDTH + x] = SoftCanvas::SoftGray(Color{ src[0], src[1], src[2], src[3] });
+        }
+    }
+    OledEncode(gray, OLED_WIDTH, threshold, out, level);
+    return true;
+}
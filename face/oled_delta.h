@@ -0,0 +1,150 @@
+#pragma once
+#include "oled.h"
+#include <stdint.h>
+#include <string.h>
+
+// --- OLED frame deltas ---
+// Packet sent over the display link in place of a full 1024-byte frame:
+//   u8  flags          OLED_DELTA_KEYFRAME: every byte of the frame is covered
+//   u16 spanCount      little endian
+//   spans: u8 page, u8 column, u8 length - 1, then PackBits data for `length` bytes
+// A span is a dirty run of columns inside one page, which maps straight onto the
+// SSD1306 page / column address window. PackBits control byte c: 0..127 copies the
+// next c + 1 bytes, 129..255 repeats the next byte 257 - c times.
+#define OLED_DELTA_KEYFRAME 0x01
+// Unchanged bytes this short between two dirty runs are resent rather than paying a span header
+#define OLED_DELTA_MERGE_GAP 3
+// Worst case packet: a keyframe of incompressible pages
+#define OLED_DELTA_MAX_BYTES (3 + OLED_PAGES * (3 + OLED_WIDTH + 1))
+
+// PackBits one run of bytes; returns bytes written (at most count + count / 128 + 1)
+inline int OledDeltaPackBits(const uint8_t *src, int count, uint8_t *out) {
+    int written = 0;
+    int i = 0;
+    while (i < count) {
+        // Repeats of 3+ are worth a control byte of their own
+        int run = 1;
+        while (i + run < count && run < 128 && src[i + run] == src[i]) run++;
+        if (run >= 3) {
+            out[written++] = (uint8_t)(257 - run);
+            out[written++] = src[i];
+            i += run;
+            continue;
+        }
+
+        // Literal stretch up to the next repeat of 3+
+        int start = i;
+        while (i < count && i - start < 128) {
+            if (i + 2 < count && src[i] == src[i + 1] && src[i] == src[i + 2]) break;
+            i++;
+        }
+        out[written++] = (uint8_t)(i - start - 1);
+        memcpy(out + written, src + start, i - start);
+        written += i - start;
+    }
+    return written;
+}
+
+// Appends one span; returns bytes written
+inline int OledDeltaWriteSpan(const uint8_t *frameBytes, int page, int column, int length, uint8_t *out) {
+    out[0] = (uint8_t)page;
+    out[1] = (uint8_t)column;
+    out[2] = (uint8_t)(length - 1);
+    return 3 + OledDeltaPackBits(frameBytes + page * OLED_WIDTH + column, length, out + 3);
+}
+
+// Every page as one full-width span
+inline int OledDeltaEncodeKeyframe(const OledFrame &cur, uint8_t *out) {
+    int written = 3;
+    for (int page = 0; page < OLED_PAGES; page++) written += OledDeltaWriteSpan(cur.bytes, page, 0, OLED_WIDTH, out + written);
+    out[0] = OLED_DELTA_KEYFRAME;
+    out[1] = OLED_PAGES;
+    out[2] = 0;
+    return written;
+}
+
+// OledDeltaEncode: Packet turning `prev` into `cur` (prev == nullptr: keyframe). out must
+// hold OLED_DELTA_MAX_BYTES. Falls back to a keyframe whenever that is smaller.
+inline int OledDeltaEncode(const OledFrame *prev, const OledFrame &cur, uint8_t *out) {
+    if (!prev) return OledDeltaEncodeKeyframe(cur, out);
+
+    // Spans are written into scratch, since a frame of scattered changes can outgrow
+    // the keyframe before the encoder knows it
+    uint8_t scratch[2 * OLED_FRAME_BYTES + OLED_DELTA_MAX_BYTES];
+    int written = 3, spans = 0;
+    for (int page = 0; page < OLED_PAGES; page++) {
+        const uint8_t *a = prev->bytes + page * OLED_WIDTH;
+        const uint8_t *b = cur.bytes + page * OLED_WIDTH;
+        int x = 0;
+        while (x < OLED_WIDTH) {
+            // Skip unchanged columns 8 at a time
+            if (x + 8 <= OLED_WIDTH) {
+                uint64_t wa, wb;
+                memcpy(&wa, a + x, 8);
+                memcpy(&wb, b + x, 8);
+                if (wa == wb) {
+                    x += 8;
+                    continue;
+                }
+            }
+            if (a[x] == b[x]) {
+                x++;
+                continue;
+            }
+
+            // Dirty run, extended across short clean gaps
+            int start = x, end = x + 1;
+            for (int probe = end; probe < OLED_WIDTH && probe <= end + OLED_DELTA_MERGE_GAP; probe++) {
+                if (a[probe] != b[probe]) end = probe + 1;
+            }
+            written += OledDeltaWriteSpan(cur.bytes, page, start, end - start, scratch + written);
+            spans++;
+            x = end;
+        }
+        if (written > OLED_DELTA_MAX_BYTES) return OledDeltaEncodeKeyframe(cur, out);
+    }
+
+    scratch[0] = 0;
+    scratch[1] = (uint8_t)(spans & 0xFF);
+    scratch[2] = (uint8_t)(spans >> 8);
+    if (written > OLED_FRAME_BYTES / 2) {
+        int keySize = OledDeltaEncodeKeyframe(cur, out);
+        if (keySize <= written) return keySize;
+    }
+    memcpy(out, scratch, written);
+    return written;
+}
+
+// OledDeltaDecode: Applies a packet to `frame` (the previous frame, ignored for keyframes).
+// Returns false and leaves the frame partly updated if the packet is malformed.
+inline bool OledDeltaDecode(const uint8_t *data, int size, OledFrame &frame) {
+    if (size < 3) return false;
+    int spans = data[1] | (data[2] << 8);
+    int pos = 3;
+    for (int s = 0; s < spans; s++) {
+        if (pos + 3 > size) return false;
+        int page = data[pos], column = data[pos + 1], length = data[pos + 2] + 1;
+        pos += 3;
+        if (page >= OLED_PAGES || column + length > OLED_WIDTH) return false;
+
+        uint8_t *dst = frame.bytes + page * OLED_WIDTH + column;
+        int filled = 0;
+        while (filled < length) {
+            if (pos >= size) return false;
+            int control = data[pos++];
+            if (control < 128) {
+                int n = control + 1;
+                if (filled + n > length || pos + n > size) return false;
+                memcpy(dst + filled, data + pos, n);
+                pos += n;
+                filled += n;
+            } else if (control > 128) {
+                int n = 257 - control;
+                if (filled + n > length || pos >= size) return false;
+                memset(dst + filled, data[pos++], n);
+                filled += n;
+            }
+        }
+    }
+    return pos == size;
+}
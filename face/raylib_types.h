@@ -0,0 +1,19 @@
+#pragma once
+
+// raylib's plain structs, for code that must also build without raylib.
+// Same trick as raymath.h: when raylib.h was included first its RL_*_TYPE
+// markers are set and these are skipped.
+#if !defined(RL_VECTOR2_TYPE)
+typedef struct Vector2 { float x; float y; } Vector2;
+#define RL_VECTOR2_TYPE
+#endif
+
+#if !defined(RL_RECTANGLE_TYPE)
+typedef struct Rectangle { float x; float y; float width; float height; } Rectangle;
+#define RL_RECTANGLE_TYPE
+#endif
+
+#if !defined(RL_COLOR_TYPE)
+typedef struct Color { unsigned char r; unsigned char g; unsigned char b; unsigned char a; } Color;
+#define RL_COLOR_TYPE
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+#include "eye_config.h"
+#include "eye_transition.h"
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+// --- SimClock ---
+// Fixed-rate simulation clock, decoupled from the render rate. Each frame feeds in the
+// real frame time; the clock runs as many whole steps as fit and keeps the remainder.
+// Rendering then blends the last two simulated states by Alpha(), so motion is smooth
+// at any frame rate and animation speed no longer depends on it.
+class SimClock {
+public:
+    explicit SimClock(float hz = 200.0f, int maxStepsPerFrame = 25) : maxSteps(maxStepsPerFrame) { SetRate(hz); }
+
+    float timeScale = 1.0f; // > 1 runs the simulation faster than real time
+
+    void SetRate(float hz) { step = 1.0 / hz; }
+    float StepSeconds() const { return (float)step; }
+    float Rate() const { return (float)(1.0 / step); }
+
+    // SimClock::Advance: Calls stepFn(h) once per fixed step covered by dt; returns the
+    // number of steps. Beyond maxSteps the backlog is dropped instead of piling up.
+    template <typename F>
+    int Advance(float dt, F stepFn) {
+        accumulator += (double)dt * timeScale;
+        // Steps due, with a hair of tolerance so a whole number isn't lost to rounding
+        int n = (int)(accumulator / step + 1e-6);
+        accumulator = fmax(accumulator - n * step, 0.0);
+        if (n > maxSteps) {
+            dropped += (n - maxSteps) * step;
+            n = maxSteps;
+        }
+        for (int i = 0; i < n; i++) {
+            stepFn((float)step);
+            steps++;
+        }
+        return n;
+    }
+
+    // Blend factor between the previous and the latest simulated state, in [0, 1)
+    float Alpha() const { return (float)(accumulator / step); }
+
+    uint64_t Steps() const { return steps; }
+    double Time() const { return steps * step; }
+    double DroppedSeconds() const { return dropped; }
+
+private:
+    double step = 1.0 / 200.0;
+    double accumulator = 0.0;
+    double dropped = 0.0;
+    uint64_t steps = 0;
+    int maxSteps;
+};
+
+// --- EyeSimFrames ---
+// The last two simulated poses of many faces, for rendering between steps
+struct EyeSimFrames {
+    std::vector<EyeConfig> prev, cur;
+    std::vector<float> alpha; // scratch for EyeConfigLerpBatch
+
+    int Count() const { return (int)cur.size(); }
+
+    void Resize(int n, const EyeConfig &cfg) {
+        prev.assign(n, cfg);
+        cur.assign(n, cfg);
+        alpha.resize(n);
+    }
+
+    // Call once per simulation step with that step's result
+    void Push(const EyeConfig *state) {
+        prev.swap(cur);
+        cur.assign(state, state + prev.size());
+    }
+
+    // Poses at `a` of the way from the previous step to the latest
+    void Interpolate(float a, EyeConfig *out, SimdLevel level = DetectSimdLevel()) {
+        alpha.assign(cur.size(), a);
+        EyeConfigLerpBatch(prev.data(), cur.data(), alpha.data(), out, Count(), level);
+    }
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+// --- Runtime SIMD dispatch ---
+// Kernels are compiled for every level with per-function target attributes, so the
+// binary runs anywhere and picks the widest path the CPU reports at startup.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define FACE_SIMD_X86 1
+#include <immintrin.h>
+#define FACE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define FACE_SIMD_X86 0
+#define FACE_TARGET_AVX2
+#endif
+
+enum SimdLevel { SIMD_SCALAR = 0, SIMD_SSE2 = 1, SIMD_AVX2 = 2 };
+
+inline SimdLevel DetectSimdLevel() {
+#if FACE_SIMD_X86
+    static const SimdLevel level = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? SIMD_AVX2
+                                 : __builtin_cpu_supports("sse2") ? SIMD_SSE2
+                                 : SIMD_SCALAR;
+    return level;
+#else
+    return SIMD_SCALAR;
+#endif
+}
+
+inline const char *SimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SIMD_AVX2: return "avx2";
+        case SIMD_SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
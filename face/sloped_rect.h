@@ -0,0 +1,81 @@
+#pragma once
+#include "arc_lod.h"
+#include "arc_tables.h"
+#include "raylib_types.h"
+#include <math.h>
+
+// Upper bound on arc segments per corner (the largest baked direction table)
+#define SLOPED_RECT_MAX_SEGMENTS ARC_TABLE_MAX_SEGMENTS
+// Fan centre + 4 arcs of (segments + 1) points + closing point
+#define SLOPED_RECT_MAX_POINTS (4 * (SLOPED_RECT_MAX_SEGMENTS + 1) + 2)
+
+// Appends the quarter arc of quadrant q walked backwards, from (q + 1) * 90 down to q * 90 degrees
+// (counter-clockwise on screen). Directions come from the baked tables: no trig per vertex.
+inline int SlopedRectAddArc(Vector2 *points, int count, Vector2 center, float radius, int quadrant, int segments)
+{
+    if (radius <= 0.0f) {
+        // Sharp corner: a single point instead of (segments + 1) copies of it
+        points[count++] = center;
+        return count;
+    }
+
+    const Vector2 *dir = QuarterArcDirections(segments);
+    for (int i = segments; i >= 0; i--) {
+        points[count++] = ArcTablePoint(dir, i, quadrant, center, radius);
+    }
+    return count;
+}
+
+// TessellateSlopedRoundedRectangle: Builds the exact boundary of MyDrawSlopedRoundedRectangle
+// (four arcs joined by the left, bottom, sloped right and top edges) as a single triangle fan.
+// points[0] is the fan centre and the outline is closed, so the result can go straight to
+// DrawTriangleFan. The shape is star-shaped around the fan centre (see step 3), so the fan
+// triangles never overlap and every interior pixel is written exactly once.
+// segments <= 0 picks each corner's count from its radius (ArcSegmentCount).
+// points must hold SLOPED_RECT_MAX_POINTS entries. Returns the number of points written.
+inline int TessellateSlopedRoundedRectangle(Rectangle rec, float radiusBottom, float radiusTop, float slopeFactor, int segments, Vector2 *points)
+{
+    // 1. Calculate and constrain radii (same rules as the old overlap fill)
+    radiusBottom = fmaxf(0.0f, radiusBottom);
+    radiusTop = fmaxf(0.0f, radiusTop);
+
+    float maxRadius = fminf(rec.width, rec.height) / 2.0f;
+    radiusBottom = fminf(radiusBottom, maxRadius);
+    radiusTop = fminf(radiusTop, maxRadius);
+
+    if (segments > SLOPED_RECT_MAX_SEGMENTS) segments = SLOPED_RECT_MAX_SEGMENTS;
+    int segmentsTop = ArcSegmentsOrAuto(segments, radiusTop);
+    int segmentsBottom = ArcSegmentsOrAuto(segments, radiusBottom);
+
+    // 2. Arc centres, top-right one pulled in by the slope. The shift stops once the top-right
+    // centre reaches the left ones (the old top_straight_width <= 0 case), so a steep slope or a
+    // narrow rect can't walk the top-right arc past the left side and fold the outline
+    float actualSlopeShift = fminf(slopeFactor * rec.height, rec.width - radiusTop - fmaxf(radiusTop, radiusBottom));
+    float y_top_straight = rec.y + radiusTop;
+    float y_bottom_straight = rec.y + rec.height - radiusBottom;
+
+    Vector2 centerTL = { rec.x + radiusTop, y_top_straight };
+    Vector2 centerTR = { rec.x + rec.width - actualSlopeShift - radiusTop, y_top_straight };
+    Vector2 centerBR = { rec.x + rec.width - radiusBottom, y_bottom_straight };
+    Vector2 centerBL = { rec.x + radiusBottom, y_bottom_straight };
+
+    // 3. Fan centre, then the outline counter-clockwise (raylib's front face). Any point right of
+    // both left centres, left of both right centres and between the straight rows sees every
+    // arc chord and edge from the inside; the clamp above keeps that box non-empty
+    int count = 0;
+    points[count++] = Vector2{
+        (fmaxf(centerTL.x, centerBL.x) + fminf(centerTR.x, centerBR.x)) / 2.0f,
+        (y_top_straight + y_bottom_straight) / 2.0f
+    };
+
+    count = SlopedRectAddArc(points, count, centerTL, radiusTop, 2, segmentsTop);       // TL 270->180, then left edge
+    count = SlopedRectAddArc(points, count, centerBL, radiusBottom, 1, segmentsBottom); // BL 180->90, then bottom edge
+    count = SlopedRectAddArc(points, count, centerBR, radiusBottom, 0, segmentsBottom); // BR 90->0, then sloped right edge
+    count = SlopedRectAddArc(points, count, centerTR, radiusTop, 3, segmentsTop);       // TR 360->270, then top edge
+
+    // Close the fan back onto the first outline point
+    points[count] = points[1];
+    count++;
+
+    return count;
+}
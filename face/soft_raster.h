@@ -0,0 +1,263 @@
+#pragma once
+#include "eye_mesh.h"
+#include "raylib_types.h"
+#include "sloped_rect.h"
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+// --- Software rasterizer ---
+// Headless backend for the eye shapes: fills the same outlines the raylib path draws
+// into an in-memory GRAY8 or RGBA8 buffer. No window, no GL context.
+//
+// Coverage is analytic: every edge adds the exact signed area it sweeps in each pixel
+// to an accumulation row, and a running sum along the row gives each pixel's coverage
+// in [0, 1]. Anti-aliasing is therefore exact for straight edges, with no supersampling.
+
+enum SoftPixelFormat { SOFT_GRAY8 = 1, SOFT_RGBA8 = 4 };
+
+// Pixel rectangle, half-open: [x, x + width) x [y, y + height)
+struct SoftRect {
+    int x, y, width, height;
+};
+
+struct SoftCanvas {
+    int width = 0;
+    int height = 0;
+    SoftPixelFormat format = SOFT_RGBA8;
+    std::vector<unsigned char> pixels; // rows of width * format bytes, top row first
+
+    SoftCanvas() {}
+    SoftCanvas(int width, int height, SoftPixelFormat format) { Resize(width, height, format); }
+
+    void Resize(int w, int h, SoftPixelFormat f) {
+        width = w;
+        height = h;
+        format = f;
+        pixels.assign((size_t)w * h * f, 0);
+    }
+
+    int Stride() const { return width * format; }
+    SoftRect Bounds() const { return SoftRect{ 0, 0, width, height }; }
+
+    void Clear(Color color) {
+        if (pixels.empty()) return;
+        if (format == SOFT_GRAY8) {
+            memset(pixels.data(), SoftGray(color), pixels.size());
+            return;
+        }
+        // Fill the first row, then copy it down
+        for (int i = 0; i < Stride(); i += 4) {
+            pixels[i] = color.r; pixels[i + 1] = color.g; pixels[i + 2] = color.b; pixels[i + 3] = color.a;
+        }
+        for (int y = 1; y < height; y++) memcpy(&pixels[(size_t)y * Stride()], pixels.data(), Stride());
+    }
+
+    // Luma used when drawing a colour into a GRAY8 canvas
+    static unsigned char SoftGray(Color c) { return (unsigned char)((c.r * 77 + c.g * 150 + c.b * 29) >> 8); }
+};
+
+// Per-thread scratch rows, so filling allocates nothing once warmed up
+inline std::vector<float> &SoftRasterScratch() {
+    static thread_local std::vector<float> scratch;
+    return scratch;
+}
+
+// Adds the signed area of segment (x0, y0)-(x1, y1) to the accumulation buffer.
+// Coordinates are local to the buffer; y is already within [0, rows], x within [0, cols].
+// Rows are cols + 2 wide: pixel columns can write one past their own, never further.
+inline void SoftRasterAccumulateLine(float *acc, int stride, int cols, int rows, float x0, float y0, float x1, float y1) {
+    if (y0 == y1) return;
+    float dir = 1.0f;
+    if (y0 > y1) {
+        float t;
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+        dir = -1.0f;
+    }
+
+    float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0;
+    int yEnd = (int)ceilf(y1);
+    if (yEnd > rows) yEnd = rows;
+
+    for (int y = (int)y0; y < yEnd; y++) {
+        float *row = acc + (size_t)y * stride;
+        float dy = fminf((float)(y + 1), y1) - fmaxf((float)y, y0);
+        // Stepping x row by row drifts in float; a border-clamped edge would drift just
+        // past 0 or cols and write outside its row, so keep it on the buffer
+        float xnext = fminf(fmaxf(x + dxdy * dy, 0.0f), (float)cols);
+        float d = dy * dir;
+        float xa = fminf(x, xnext), xb = fmaxf(x, xnext);
+        float xaFloor = floorf(xa);
+        int xai = (int)xaFloor;
+        float xbCeil = ceilf(xb);
+        int xbi = (int)xbCeil;
+
+        if (xbi <= xai + 1) {
+            // The edge stays inside one pixel column on this row
+            float xmf = 0.5f * (x + xnext) - xaFloor;
+            row[xai] += d - d * xmf;
+            row[xai + 1] += d * xmf;
+        } else {
+            // Spread the trapezoid over the columns it crosses
+            float s = 1.0f / (xb - xa);
+            float xaf = xa - xaFloor;
+            float a0 = 0.5f * s * (1.0f - xaf) * (1.0f - xaf);
+            float xbf = xb - xbCeil + 1.0f;
+            float am = 0.5f * s * xbf * xbf;
+            row[xai] += d * a0;
+            if (xbi == xai + 2) {
+                row[xai + 1] += d * (1.0f - a0 - am);
+            } else {
+                float a1 = s * (1.5f - xaf);
+                row[xai + 1] += d * (a1 - a0);
+                for (int xi = xai + 2; xi < xbi - 1; xi++) row[xi] += d * s;
+                float a2 = a1 + (xbi - xai - 3) * s;
+                row[xbi - 1] += d * (1.0f - a2 - am);
+            }
+            row[xbi] += d * am;
+        }
+        x = xnext;
+    }
+}
+
+// Clips one polygon edge to the buffer and accumulates it. Parts above/below are dropped;
+// parts left/right are flattened onto the border, which keeps the winding they contribute
+// to pixels further right while leaving the in-bounds slope untouched.
+inline void SoftRasterAddEdge(float *acc, int stride, int cols, int rows, Vector2 p0, Vector2 p1) {
+    // Vertical clip
+    if ((p0.y <= 0 && p1.y <= 0) || (p0.y >= rows && p1.y >= rows) || p0.y == p1.y) return;
+    float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+    if (p0.y < 0) { p0.x += (0 - p0.y) * dxdy; p0.y = 0; }
+    if (p1.y < 0) { p1.x += (0 - p1.y) * dxdy; p1.y = 0; }
+    if (p0.y > rows) { p0.x += (rows - p0.y) * dxdy; p0.y = (float)rows; }
+    if (p1.y > rows) { p1.x += (rows - p1.y) * dxdy; p1.y = (float)rows; }
+
+    // Split at the left and right borders, clamp the outside pieces onto them
+    float xs[2] = { 0.0f, (float)cols };
+    Vector2 pts[4] = { p0 };
+    int n = 1;
+    float lo = fminf(p0.x, p1.x), hi = fmaxf(p0.x, p1.x);
+    float dydx = (p1.x != p0.x) ? (p1.y - p0.y) / (p1.x - p0.x) : 0.0f;
+    int first = (p0.x < p1.x) ? 0 : 1;
+    for (int k = 0; k < 2; k++) {
+        float xc = xs[first ^ k];
+        if (xc > lo && xc < hi) pts[n++] = Vector2{ xc, p0.y + (xc - p0.x) * dydx };
+    }
+    pts[n++] = p1;
+
+    for (int i = 0; i + 1 < n; i++) {
+        float ax = fminf(fmaxf(pts[i].x, 0.0f), (float)cols);
+        float bx = fminf(fmaxf(pts[i + 1].x, 0.0f), (float)cols);
+        SoftRasterAccumulateLine(acc, stride, cols, rows, ax, pts[i].y, bx, pts[i + 1].y);
+    }
+}
+
+// Writes `color` at the given coverage over one destination pixel (source-over)
+inline void SoftBlendPixel(unsigned char *dst, SoftPixelFormat format, Color color, float coverage) {
+    float a = coverage * (color.a / 255.0f);
+    if (a >= 1.0f) {
+        // Interior of an opaque shape: plain store
+        if (format == SOFT_GRAY8) dst[0] = SoftCanvas::SoftGray(color);
+        else { dst[0] = color.r; dst[1] = color.g; dst[2] = color.b; dst[3] = 255; }
+        return;
+    }
+    if (format == SOFT_GRAY8) {
+        float g = SoftCanvas::SoftGray(color);
+        dst[0] = (unsigned char)(dst[0] + (g - dst[0]) * a + 0.5f);
+        return;
+    }
+    dst[0] = (unsigned char)(dst[0] + (color.r - dst[0]) * a + 0.5f);
+    dst[1] = (unsigned char)(dst[1] + (color.g - dst[1]) * a + 0.5f);
+    dst[2] = (unsigned char)(dst[2] + (color.b - dst[2]) * a + 0.5f);
+    dst[3] = (unsigned char)(dst[3] + (255 - dst[3]) * a + 0.5f);
+}
+
+// SoftFillPolygon: Fills a closed polygon (any winding, last point joins the first) with
+// anti-aliased coverage. Only pixels inside clip (default: the whole canvas) are touched,
+// which is what lets tiles of one canvas be filled from different threads.
+inline void SoftFillPolygon(SoftCanvas &canvas, const Vector2 *points, int count, Color color, const SoftRect *clip = nullptr) {
+    if (count < 3) return;
+
+    // Work area: polygon bounds inside the clip rect
+    SoftRect area = clip ? *clip : canvas.Bounds();
+    float minX = points[0].x, maxX = points[0].x, minY = points[0].y, maxY = points[0].y;
+    for (int i = 1; i < count; i++) {
+        minX = fminf(minX, points[i].x); maxX = fmaxf(maxX, points[i].x);
+        minY = fminf(minY, points[i].y); maxY = fmaxf(maxY, points[i].y);
+    }
+    int x0 = (int)floorf(minX), y0 = (int)floorf(minY);
+    int x1 = (int)ceilf(maxX), y1 = (int)ceilf(maxY);
+    if (x0 < area.x) x0 = area.x;
+    if (y0 < area.y) y0 = area.y;
+    if (x1 > area.x + area.width) x1 = area.x + area.width;
+    if (y1 > area.y + area.height) y1 = area.y + area.height;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > canvas.width) x1 = canvas.width;
+    if (y1 > canvas.height) y1 = canvas.height;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    // Pieces left of the work area still wind the pixels inside it, so the polygon is
+    // accumulated in coordinates local to (x0, y0) and clamped rather than skipped
+    int cols = x1 - x0, rows = y1 - y0;
+    int stride = cols + 2;
+    std::vector<float> &acc = SoftRasterScratch();
+    acc.assign((size_t)stride * rows, 0.0f);
+
+    for (int i = 0; i < count; i++) {
+        Vector2 a = points[i], b = points[(i + 1) % count];
+        SoftRasterAddEdge(acc.data(), stride, cols, rows, Vector2{ a.x - x0, a.y - y0 }, Vector2{ b.x - x0, b.y - y0 });
+    }
+
+    // Running sum along each row turns area deltas into coverage
+    for (int y = 0; y < rows; y++) {
+        const float *row = acc.data() + (size_t)y * stride;
+        unsigned char *dst = canvas.pixels.data() + (size_t)(y0 + y) * canvas.Stride() + (size_t)x0 * canvas.format;
+        float sum = 0.0f;
+        for (int x = 0; x < cols; x++, dst += canvas.format) {
+            sum += row[x];
+            float coverage = fminf(fabsf(sum), 1.0f);
+            if (coverage > 1.0f / 512.0f) SoftBlendPixel(dst, canvas.format, color, coverage);
+        }
+    }
+}
+
+// SoftBlitMask: Blends `color` through a GRAY8 coverage mask with its top-left at (x, y),
+// clipped to clip (default: the whole canvas). Same result as filling the shape the mask
+// was rendered from, to within the mask's 8-bit coverage.
+inline void SoftBlitMask(SoftCanvas &canvas, const SoftCanvas &mask, int x, int y, Color color, const SoftRect *clip = nullptr) {
+    SoftRect area = clip ? *clip : canvas.Bounds();
+    int x0 = x > area.x ? x : area.x, y0 = y > area.y ? y : area.y;
+    int x1 = x + mask.width < area.x + area.width ? x + mask.width : area.x + area.width;
+    int y1 = y + mask.height < area.y + area.height ? y + mask.height : area.y + area.height;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > canvas.width) x1 = canvas.width;
+    if (y1 > canvas.height) y1 = canvas.height;
+
+    for (int py = y0; py < y1; py++) {
+        const unsigned char *src = mask.pixels.data() + (size_t)(py - y) * mask.width + (x0 - x);
+        unsigned char *dst = canvas.pixels.data() + (size_t)py * canvas.Stride() + (size_t)x0 * canvas.format;
+        for (int px = x0; px < x1; px++, src++, dst += canvas.format) {
+            if (*src) SoftBlendPixel(dst, canvas.format, color, *src * (1.0f / 255.0f));
+        }
+    }
+}
+
+// --- Shape entry points, same geometry as the raylib draw calls ---
+
+// Filled eye as EyeDrawer::Draw lays it out around (centerX, centerY)
+inline void SoftDrawEye(SoftCanvas &canvas, float centerX, float centerY, const EyeConfig &cfg, Color color, const SoftRect *clip = nullptr) {
+    Vector2 outline[4 * (ARC_TABLE_MAX_SEGMENTS + 1)];
+    int count = EyeOutline(cfg, centerX, centerY, 0, outline);
+    SoftFillPolygon(canvas, outline, count, color, clip);
+}
+
+// MyDrawSlopedRoundedRectangle into a canvas (the fan's outline, without its centre point)
+inline void SoftDrawSlopedRoundedRectangle(SoftCanvas &canvas, Rectangle rec, float radiusBottom, float radiusTop, float slopeFactor, int segments, Color color, const SoftRect *clip = nullptr) {
+    Vector2 points[SLOPED_RECT_MAX_POINTS];
+    int count = TessellateSlopedRoundedRectangle(rec, radiusBottom, radiusTop, slopeFactor, segments, points);
+    SoftFillPolygon(canvas, points + 1, count - 2, color, clip);
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include "soft_raster.h"
+#include "job_system.h"
+#include <vector>
+
+// Tile edge in pixels: 64x64 RGBA8 is 16 KB, small enough to stay in L1/L2 while every
+// eye touching it is filled
+#define TILE_RASTER_SIZE 64
+
+// One eye to render: EyeDrawer::Draw arguments
+struct SoftEye {
+    float centerX, centerY;
+    EyeConfig cfg;
+    Color color;
+};
+
+// --- TileRenderer ---
+// Multithreaded SoftDrawEye for many faces on a large canvas. Each frame:
+//   1. outlines: every eye tessellated once, in parallel
+//   2. binning: each eye's bounding box appended to the tiles it overlaps, in eye order
+//   3. raster: tiles in parallel, each filling its bin clipped to the tile
+// A tile belongs to exactly one thread for the whole pass, so writes to the canvas need
+// no locks, and bins keep eye order, so overlapping eyes blend in the same order as a
+// serial draw.
+class TileRenderer {
+public:
+    // threads <= 0: one per hardware thread
+    explicit TileRenderer(int threads = 0) : jobs(threads) {}
+
+    int Threads() const { return jobs.Threads(); }
+
+    void Render(SoftCanvas &canvas, const std::vector<SoftEye> &eyes) {
+        const int stride = 4 * (ARC_TABLE_MAX_SEGMENTS + 1);
+        int eyeCount = (int)eyes.size();
+        tilesX = (canvas.width + TILE_RASTER_SIZE - 1) / TILE_RASTER_SIZE;
+        tilesY = (canvas.height + TILE_RASTER_SIZE - 1) / TILE_RASTER_SIZE;
+
+        // 1. Outlines and bounds, up to 64 eyes per job
+        outlines.resize((size_t)eyeCount * stride);
+        counts.resize(eyeCount);
+        bounds.resize(eyeCount);
+        jobs.ParallelFor(eyeCount, 64, [&](int begin, int end) {
+            for (int e = begin; e < end; e++) {
+                Vector2 *points = &outlines[(size_t)e * stride];
+                counts[e] = EyeOutline(eyes[e].cfg, eyes[e].centerX, eyes[e].centerY, 0, points);
+                bounds[e] = PolygonBounds(points, counts[e]);
+            }
+        });
+
+        // 2. Binning
+        bins.resize((size_t)tilesX * tilesY);
+        for (std::vector<int> &bin : bins) bin.clear();
+        for (int e = 0; e < eyeCount; e++) {
+            const SoftRect &b = bounds[e];
+            if (b.width <= 0 || b.height <= 0 || b.x + b.width <= 0 || b.y + b.height <= 0) continue;
+            int tx0 = b.x / TILE_RASTER_SIZE, ty0 = b.y / TILE_RASTER_SIZE;
+            int tx1 = (b.x + b.width - 1) / TILE_RASTER_SIZE, ty1 = (b.y + b.height - 1) / TILE_RASTER_SIZE;
+            if (tx0 < 0) tx0 = 0;
+            if (ty0 < 0) ty0 = 0;
+            if (tx1 >= tilesX) tx1 = tilesX - 1;
+            if (ty1 >= tilesY) ty1 = tilesY - 1;
+            for (int ty = ty0; ty <= ty1; ty++) {
+                for (int tx = tx0; tx <= tx1; tx++) bins[(size_t)ty * tilesX + tx].push_back(e);
+            }
+        }
+
+        // 3. Raster, one tile per job
+        jobs.ParallelFor(tilesX * tilesY, 1, [&](int begin, int end) {
+            for (int tile = begin; tile < end; tile++) {
+                const std::vector<int> &bin = bins[tile];
+                SoftRect clip = { (tile % tilesX) * TILE_RASTER_SIZE, (tile / tilesX) * TILE_RASTER_SIZE, TILE_RASTER_SIZE, TILE_RASTER_SIZE };
+                for (int e : bin) SoftFillPolygon(canvas, &outlines[(size_t)e * stride], counts[e], eyes[e].color, &clip);
+            }
+        });
+    }
+
+    // Binning statistics of the last frame, for profiling
+    int TileCount() const { return tilesX * tilesY; }
+    int BinnedEyes() const {
+        int total = 0;
+        for (const std::vector<int> &bin : bins) total += (int)bin.size();
+        return total;
+    }
+
+private:
+    // Covered pixels of a polygon, outward-rounded
+    static SoftRect PolygonBounds(const Vector2 *points, int count) {
+        float minX = points[0].x, maxX = points[0].x, minY = points[0].y, maxY = points[0].y;
+        for (int i = 1; i < count; i++) {
+            minX = fminf(minX, points[i].x); maxX = fmaxf(maxX, points[i].x);
+            minY = fminf(minY, points[i].y); maxY = fmaxf(maxY, points[i].y);
+        }
+        int x0 = (int)floorf(minX), y0 = (int)floorf(minY);
+        return SoftRect{ x0, y0, (int)ceilf(maxX) - x0, (int)ceilf(maxY) - y0 };
+    }
+
+    JobSystem jobs;
+    int tilesX = 0, tilesY = 0;
+    std::vector<Vector2> outlines;
+    std::vector<int> counts;
+    std::vector<SoftRect> bounds;
+    std::vector<std::vector<int>> bins;
+};
@@ -0,0 +1,144 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+// --- TimerWheel ---
+// Hierarchical timing wheel: TIMER_WHEEL_LEVELS rings of 64 slots, ring L covering
+// 64^L ticks per slot. Scheduling and cancelling are O(1); advancing a tick costs only
+// the timers that fire, plus an occasional cascade of one slot down a level. Nothing
+// is scanned per pending timer, so thousands of idle faces cost nothing between events.
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_LEVELS 4
+// Longest delay in ticks; longer requests are clamped
+#define TIMER_WHEEL_MAX_DELAY ((1u << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS)) - 1)
+
+// Handle of a scheduled timer: pool index plus a generation, so a stale handle can't
+// cancel the timer that later reuses its node
+typedef uint64_t TimerHandle;
+
+class TimerWheel {
+public:
+    TimerWheel() {
+        for (uint32_t &head : slots) head = NIL;
+    }
+
+    uint64_t Now() const { return now; }
+    int Pending() const { return pending; }
+
+    // Fires `payload` after `delay` ticks (at least 1)
+    TimerHandle Schedule(uint32_t delay, uint32_t payload) {
+        if (delay < 1) delay = 1;
+        if (delay > TIMER_WHEEL_MAX_DELAY) delay = TIMER_WHEEL_MAX_DELAY;
+
+        uint32_t index;
+        if (freeHead != NIL) {
+            index = freeHead;
+            freeHead = nodes[index].next;
+        } else {
+            index = (uint32_t)nodes.size();
+            nodes.push_back(Node());
+        }
+        Node &node = nodes[index];
+        node.expiry = now + delay;
+        node.payload = payload;
+        node.active = true;
+        Link(index);
+        pending++;
+        return (TimerHandle)node.generation << 32 | index;
+    }
+
+    // Returns false if the timer already fired or was cancelled
+    bool Cancel(TimerHandle handle) {
+        uint32_t index = (uint32_t)handle;
+        if (index >= nodes.size()) return false;
+        Node &node = nodes[index];
+        if (!node.active || node.generation != (uint32_t)(handle >> 32)) return false;
+        Unlink(index);
+        Release(index);
+        return true;
+    }
+
+    // TimerWheel::Advance: Moves time forward, calling fire(payload) for each expired
+    // timer in expiry order. fire may schedule or cancel timers.
+    template <typename F>
+    void Advance(uint32_t ticks, F fire) {
+        for (uint32_t t = 0; t < ticks; t++) {
+            now++;
+            // Refill level 0 from above whenever a lower ring wraps
+            for (int level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+                if ((now & ((1ull << (TIMER_WHEEL_SLOT_BITS * level)) - 1)) != 0) break;
+                Cascade(level, (int)((now >> (TIMER_WHEEL_SLOT_BITS * level)) & (TIMER_WHEEL_SLOTS - 1)));
+            }
+
+            uint32_t &head = slots[now & (TIMER_WHEEL_SLOTS - 1)];
+            while (head != NIL) {
+                uint32_t index = head;
+                Unlink(index);
+                uint32_t payload = nodes[index].payload;
+                Release(index);
+                fire(payload);
+            }
+        }
+    }
+
+private:
+    static const uint32_t NIL = 0xFFFFFFFFu;
+
+    struct Node {
+        uint64_t expiry = 0;
+        uint32_t prev = NIL, next = NIL;
+        uint32_t payload = 0;
+        uint32_t generation = 0;
+        uint32_t slot = 0;
+        bool active = false;
+    };
+
+    // Ring and slot from how far away the expiry is
+    void Link(uint32_t index) {
+        Node &node = nodes[index];
+        uint64_t delta = node.expiry - now;
+        int level = 0;
+        while (level + 1 < TIMER_WHEEL_LEVELS && delta >= (1ull << (TIMER_WHEEL_SLOT_BITS * (level + 1)))) level++;
+        uint32_t slot = level * TIMER_WHEEL_SLOTS + (uint32_t)((node.expiry >> (TIMER_WHEEL_SLOT_BITS * level)) & (TIMER_WHEEL_SLOTS - 1));
+
+        node.slot = slot;
+        node.prev = NIL;
+        node.next = slots[slot];
+        if (node.next != NIL) nodes[node.next].prev = index;
+        slots[slot] = index;
+    }
+
+    void Unlink(uint32_t index) {
+        Node &node = nodes[index];
+        if (node.prev != NIL) nodes[node.prev].next = node.next;
+        else slots[node.slot] = node.next;
+        if (node.next != NIL) nodes[node.next].prev = node.prev;
+    }
+
+    void Release(uint32_t index) {
+        Node &node = nodes[index];
+        node.active = false;
+        node.generation++;
+        node.next = freeHead;
+        freeHead = index;
+        pending--;
+    }
+
+    // Re-files every timer of one higher-level slot; each lands at a lower level
+    void Cascade(int level, int slot) {
+        uint32_t index = slots[level * TIMER_WHEEL_SLOTS + slot];
+        slots[level * TIMER_WHEEL_SLOTS + slot] = NIL;
+        while (index != NIL) {
+            uint32_t next = nodes[index].next;
+            Link(index);
+            index = next;
+        }
+    }
+
+    std::vector<Node> nodes;
+    uint32_t slots[TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS];
+    uint32_t freeHead = NIL;
+    uint64_t now = 0;
+    int pending = 0;
+};
@@ -2,102 +2,91 @@
 #define RAYGUI_IMPLEMENTATION
 #include "raygui.h"
 #include "raymath.h"
+#include "rlgl.h"
+#include "face/eye_blend.h"
+#include "face/eye_config.h"
+#include "face/eye_mesh.h"
+#include "face/eye_spring.h"
+#include "face/sim_clock.h"
 #include <algorithm>
 using namespace std;
 
-// --- Eye configuration ---
-struct EyeConfig {
-    float OffsetX;
-    float OffsetY;
-    float Height;
-    float Width;
-    float Slope_Top;
-    float Slope_Bottom;
-    float Radius_Top;
-    float Radius_Bottom;
-    bool Inverse_Radius_Top;
-    bool Inverse_Radius_Bottom;
-    bool Inverse_Offset_Top;
-    bool Inverse_Offset_Bottom;
-};
-
-// Preset
-static const EyeConfig Preset_Neutral = {0, 0, 40, 50, 0, 0, 10, 10, 0, 0, 0, 0};
-
 // --- EyeDrawer class ---
 enum CornerType { T_R, T_L, B_L, B_R };
 
 class EyeDrawer {
 public:
     static void Draw(int centerX, int centerY, const EyeConfig &cfg, Color color) {
-        float delta_y_top = cfg.Height * cfg.Slope_Top / 2.0f;
-        float delta_y_bottom = cfg.Height * cfg.Slope_Bottom / 2.0f;
-        float totalHeight = cfg.Height + delta_y_top - delta_y_bottom;
-
-        float rTop = cfg.Radius_Top;
-        float rBottom = cfg.Radius_Bottom;
-        if (rTop + rBottom > totalHeight - 1) {
-            float scale = (totalHeight - 1) / (rTop + rBottom);
-            rTop *= scale;
-            rBottom *= scale;
-        }
-
-        Vector2 TL = { centerX + cfg.OffsetX - cfg.Width / 2 + rTop,
-                       centerY + cfg.OffsetY - cfg.Height / 2 + rTop - delta_y_top };
-        Vector2 TR = { centerX + cfg.OffsetX + cfg.Width / 2 - rTop,
-                       centerY + cfg.OffsetY - cfg.Height / 2 + rTop + delta_y_top };
-        Vector2 BL = { centerX + cfg.OffsetX - cfg.Width / 2 + rBottom,
-                       centerY + cfg.OffsetY + cfg.Height / 2 - rBottom - delta_y_bottom };
-        Vector2 BR = { centerX + cfg.OffsetX + cfg.Width / 2 - rBottom,
-                       centerY + cfg.OffsetY + cfg.Height / 2 - rBottom + delta_y_bottom };
-
-        // Top line
-        DrawLineV(TL, TR, color);
-
-        // Bottom line
-        DrawLineV(BL, BR, color);
-
-        // Vertical lines
-        Vector2 TL_side = {TL.x - rTop, TL.y};
-        Vector2 BL_side = {BL.x - rBottom, BL.y};
-        DrawLineV(TL_side, BL_side, color);
-
-        Vector2 TR_side = {TR.x + rTop, TR.y};
-        Vector2 BR_side = {BR.x + rBottom, BR.y};
-        DrawLineV(TR_side, BR_side, color);
-
-        // Rounded corners
-        if (rTop > 0) {
-            DrawCircleSector(TL, rTop, 180, 270, 0, color); // Top-left corner
-            DrawCircleSector(TR, rTop, 270, 360, 0, color); // Top-right corner
-        }
-        if (rBottom > 0) {
-            DrawCircleSector(BL, rBottom, 90, 180, 0, color); // Bottom-left corner
-            DrawCircleSector(BR, rBottom, 0, 90, 0, color); // Bottom-right corner
-        }
+        // Geometry is only rebuilt when cfg changes; submit it as one batch per primitive type
+        Submit(meshCache.Get(cfg), centerX, centerY, false, color);
+    }
 
-        // Top slope triangle
-        if (cfg.Slope_Top != 0) {
-            Vector2 apex = {(TL.x + TR.x) / 2, TL.y - cfg.Slope_Top * cfg.Height};
-            DrawTriangleLines(TL, TR, apex, color);
+    // Both eyes `spacing` either side of the centre. The right eye reuses the left eye's
+    // mesh, moved or mirrored; only an asymmetric right eye is tessellated on its own.
+    static void DrawPair(int centerX, int centerY, int spacing, const EyeConfig &cfg, Color color) {
+        const EyeMesh &left = meshCache.Get(cfg);
+        Submit(left, centerX - spacing, centerY, false, color);
+
+        EyeConfig right = EyeConfigRight(cfg);
+        switch (EyeMeshReuseFor(cfg, right)) {
+            case EYE_REUSE_TRANSLATE: Submit(left, centerX + spacing, centerY, false, color); break;
+            case EYE_REUSE_MIRROR: Submit(left, centerX + spacing, centerY, true, color); break;
+            default: Draw(centerX + spacing, centerY, right, color); break;
         }
+    }
 
-        // Bottom slope triangle
-        if (cfg.Slope_Bottom != 0) {
-            Vector2 apex = {(BL.x + BR.x) / 2, BL.y + cfg.Slope_Bottom * cfg.Height};
-            DrawTriangleLines(BL, BR, apex, color);
+private:
+    static void Submit(const EyeMesh &mesh, int centerX, int centerY, bool mirror, Color color) {
+        float sx = mirror ? -1.0f : 1.0f;
+
+        rlBegin(RL_LINES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (const Vector2 &v : mesh.lines) rlVertex2f(centerX + sx * v.x, centerY + v.y);
+        rlEnd();
+
+        // Mirroring flips the winding; swap two vertices so the triangles stay front facing
+        rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        const std::vector<Vector2> &tri = mesh.triangles;
+        for (size_t i = 0; i + 2 < tri.size(); i += 3) {
+            const Vector2 &a = tri[i], &b = tri[mirror ? i + 2 : i + 1], &c = tri[mirror ? i + 1 : i + 2];
+            rlVertex2f(centerX + sx * a.x, centerY + a.y);
+            rlVertex2f(centerX + sx * b.x, centerY + b.y);
+            rlVertex2f(centerX + sx * c.x, centerY + c.y);
         }
+        rlEnd();
     }
+
+    static inline EyeMeshCache meshCache;
 };
 
 // --- Main ---
 int main() {
+    // Render as fast as the display allows; springs and blink run on a fixed 200 Hz clock
+    SetConfigFlags(FLAG_VSYNC_HINT);
     InitWindow(1000, 600, "Eye Config Controller");
-    SetTargetFPS(60);
+    SimClock sim(200.0f);
+    EyeSimFrames frames;
+    frames.Resize(1, Preset_Neutral);
 
     EyeConfig cfg = Preset_Neutral;
     Color eyeColor = SKYBLUE;
 
+    // Sliders move the spring target, the spring output is the base layer; gaze follows
+    // the mouse and B blinks on top of it
+    EyeSpringBatch spring;
+    spring.Resize(1, cfg);
+    EyeBlendTree blend;
+    blend.Resize(1, cfg);
+    int gazeLayer = blend.AddLayer(EYE_BLEND_ADD, EYE_FIELDS_GAZE);
+    int blinkLayer = blend.AddLayer(EYE_BLEND_MULTIPLY, EYE_FIELD_BIT(EYE_FIELD_HEIGHT));
+    blend.SetValue(blinkLayer, EYE_FIELD_HEIGHT, 0, 0.05f);
+    float blinkTime = 1.0f;
+
+    // GUI panel column; the gaze ignores the mouse once it is over the panel
+    const float panelX = 700;
+    const float panelMargin = 20;
+
     while (!WindowShouldClose()) {
         BeginDrawing();
         ClearBackground(BLACK);
@@ -105,12 +94,29 @@ int main() {
         // Draw eyes
         float centerX = GetScreenWidth() / 2.0f;
         float centerY = GetScreenHeight() / 2.0f;
-        EyeDrawer::Draw(centerX - 75, centerY, cfg, eyeColor);
-        EyeDrawer::Draw(centerX + 75, centerY, cfg, eyeColor);
+
+        Vector2 mouse = GetMousePosition();
+        if (IsKeyPressed(KEY_B)) blinkTime = 0.0f;
+        sim.Advance(GetFrameTime(), [&](float h) {
+            spring.SetTarget(0, cfg);
+            spring.Step(h);
+            blinkTime += h;
+            blend.SetBase(0, spring.pos[0]);
+            blend.SetValue(gazeLayer, EYE_FIELD_OFFSET_X, 0, Clamp((mouse.x - centerX) * 0.05f, -15, 15));
+            blend.SetValue(gazeLayer, EYE_FIELD_OFFSET_Y, 0, Clamp((mouse.y - centerY) * 0.05f, -10, 10));
+            blend.SetWeight(gazeLayer, 0, mouse.x < panelX - panelMargin ? 1.0f : 0.0f);
+            blend.SetWeight(blinkLayer, 0, Clamp(1.0f - fabsf(blinkTime - 0.08f) / 0.08f, 0, 1));
+            EyeConfig pose;
+            blend.Evaluate(&pose);
+            frames.Push(&pose);
+        });
+        EyeConfig pose;
+        frames.Interpolate(sim.Alpha(), &pose);
+        EyeDrawer::DrawPair(centerX, centerY, 75, pose, eyeColor);
 
         // --- GUI controls ---
         GuiSetStyle(DEFAULT, TEXT_SIZE, 16);
-        float panelX = 700, panelY = 30;
+        float panelY = 30;
 
         DrawText("Eye Config Controls", panelX, 10, 20, RAYWHITE);
 
@@ -131,6 +137,7 @@ int main() {
         GuiCheckBox({panelX, panelY, 20, 20}, "Inverse_Offset_Bottom", &cfg.Inverse_Offset_Bottom); panelY += 25;
 
         DrawText("Use sliders and checkboxes to control eye shape", 10, 10, 20, GRAY);
+        DrawText("Eyes follow the mouse, B blinks", 10, 40, 20, GRAY);
 
         EndDrawing();
     }
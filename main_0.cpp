@@ -1,43 +1,10 @@
 #include "raylib.h"
 #include "raymath.h"
-
-// Eye configuration structure
-struct EyeConfig {
-    float OffsetX;
-    float OffsetY;
-    float Height;
-    float Width;
-    float Slope_Top;
-    float Slope_Bottom;
-    float Radius_Top;
-    float Radius_Bottom;
-    int Inverse_Radius_Top;
-    int Inverse_Radius_Bottom;
-    int Inverse_Offset_Top;
-    int Inverse_Offset_Bottom;
-};
-
-// Example presets
-static const EyeConfig Preset_Neutral = {
-    0, 0, 40, 50,
-    0.0, 0.0,
-    10, 10,
-    0, 0, 0, 0
-};
-
-static const EyeConfig Preset_Awe = {
-    2, 0, 35, 45,
-    -0.1, 0.1,
-    12, 12,
-    0, 0, 0, 0
-};
-
-static const EyeConfig Preset_Happy = {
-    0, -3, 35, 50,
-    -0.2, 0.2,
-    10, 8,
-    0, 0, 0, 0
-};
+#include "face/eye_clip.h"
+#include "face/eye_config.h"
+#include "face/eye_idle.h"
+#include "face/eye_transition.h"
+#include "face/sim_clock.h"
 
 // Draw one pair of eyes using configuration
 void DrawEyes(const EyeConfig& cfg, Color color) {
@@ -59,18 +26,49 @@ void DrawEyes(const EyeConfig& cfg, Color color) {
         );
 }
 
-int main() {
+int main(int argc, char **argv) {
+    // Render as fast as the display allows; animation runs on its own fixed 200 Hz clock
+    SetConfigFlags(FLAG_VSYNC_HINT);
     InitWindow(800, 600, "Cozmo Face Preset Example");
-    SetTargetFPS(60);
+    SimClock sim(200.0f);
+    EyeSimFrames frames;
+    frames.Resize(1, Preset_Awe);
 
-    EyeConfig current = Preset_Awe;
+    // Preset keys set the base expression; blinks, squints and glances run on top
+    EyeIdleScheduler idle;
+    idle.Resize(1, Preset_Awe);
+    EaseType ease = EASE_IN_OUT_CUBIC;
+    const float transitionTime = 0.3f;
     Color eyeColor = SKYBLUE;
 
+    // Optional clip file: plays track 0 in a loop, SPACE toggles back to the presets
+    EyeClipFile clip;
+    bool playing = argc > 1 && clip.Open(argv[1]);
+    float clipTime = 0.0f;
+
     while (!WindowShouldClose()) {
-        // Press 1, 2, 3 to switch expressions
-        if (IsKeyPressed(KEY_ONE)) current = Preset_Neutral;
-        if (IsKeyPressed(KEY_TWO)) current = Preset_Happy;
-        if (IsKeyPressed(KEY_THREE)) current = Preset_Awe;
+        // Press 1, 2, 3 to switch expressions, E to change the easing curve
+        if (IsKeyPressed(KEY_ONE)) idle.SetExpression(0, Preset_Neutral, transitionTime, ease);
+        if (IsKeyPressed(KEY_TWO)) idle.SetExpression(0, Preset_Happy, transitionTime, ease);
+        if (IsKeyPressed(KEY_THREE)) idle.SetExpression(0, Preset_Awe, transitionTime, ease);
+        if (IsKeyPressed(KEY_E)) ease = (EaseType)((ease + 1) % EASE_COUNT);
+        if (IsKeyPressed(KEY_SPACE) && clip.View().Valid()) playing = !playing;
+
+        sim.Advance(GetFrameTime(), [&](float h) {
+            EyeConfig pose = idle.Pose(0);
+            if (playing) {
+                clipTime += h;
+                if (clipTime > clip.View().Duration()) clipTime = 0.0f;
+                clip.View().Evaluate(0, clipTime, pose);
+                idle.SetExpression(0, pose, 0.0f, EASE_LINEAR);
+            } else {
+                idle.Update(h);
+                pose = idle.Pose(0);
+            }
+            frames.Push(&pose);
+        });
+        EyeConfig current;
+        frames.Interpolate(sim.Alpha(), &current);
 
         BeginDrawing();
         ClearBackground(BLACK);
@@ -78,6 +76,9 @@ int main() {
         DrawEyes(current, eyeColor);
 
         DrawText("Press 1=Neutral, 2=Happy, 3=Awe", 10, 10, 20, GRAY);
+        DrawText(TextFormat("Easing: %s (E)", EaseName(ease)), 10, 40, 20, GRAY);
+        if (clip.View().Valid()) DrawText(TextFormat("Clip: %s %.2f s (SPACE)", playing ? "playing" : "paused", clipTime), 10, 70, 20, GRAY);
+        DrawText(TextFormat("Render %d fps, sim %.0f Hz", GetFPS(), sim.Rate()), 10, GetScreenHeight() - 30, 20, GRAY);
 
         EndDrawing();
     }